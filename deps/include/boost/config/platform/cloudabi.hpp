@@ -1,18 +0,0 @@
-//       Copyright Nuxi, https://nuxi.nl/ 2015.
-// Distributed under the Boost Software License, Version 1.0.
-//    (See accompanying file LICENSE_1_0.txt or copy at
-//          http://www.boost.org/LICENSE_1_0.txt)
-
-#define BOOST_PLATFORM "CloudABI"
-
-#define BOOST_HAS_DIRENT_H
-#define BOOST_HAS_STDINT_H
-#define BOOST_HAS_UNISTD_H
-
-#define BOOST_HAS_CLOCK_GETTIME
-#define BOOST_HAS_EXPM1
-#define BOOST_HAS_GETTIMEOFDAY
-#define BOOST_HAS_LOG1P
-#define BOOST_HAS_NANOSLEEP
-#define BOOST_HAS_PTHREADS
-#define BOOST_HAS_SCHED_YIELD
@@ -1,31 +0,0 @@
-#ifndef BOOST_CONFIG_PRAGMA_MESSAGE_HPP_INCLUDED
-#define BOOST_CONFIG_PRAGMA_MESSAGE_HPP_INCLUDED
-
-//  Copyright 2017 Peter Dimov.
-//
-//  Distributed under the Boost Software License, Version 1.0.
-//
-//  See accompanying file LICENSE_1_0.txt or copy at
-//  http://www.boost.org/LICENSE_1_0.txt
-//
-//  BOOST_PRAGMA_MESSAGE("message")
-//
-//  Expands to the equivalent of #pragma message("message")
-//
-//  Note that this header is C compatible.
-
-#include <boost/config/helper_macros.hpp>
-
-#if defined(BOOST_DISABLE_PRAGMA_MESSAGE)
-# define BOOST_PRAGMA_MESSAGE(x)
-#elif defined(__INTEL_COMPILER)
-# define BOOST_PRAGMA_MESSAGE(x) __pragma(message(__FILE__ "(" BOOST_STRINGIZE(__LINE__) "): note: " x))
-#elif defined(__GNUC__)
-# define BOOST_PRAGMA_MESSAGE(x) _Pragma(BOOST_STRINGIZE(message(x)))
-#elif defined(_MSC_VER)
-# define BOOST_PRAGMA_MESSAGE(x) __pragma(message(__FILE__ "(" BOOST_STRINGIZE(__LINE__) "): note: " x))
-#else
-# define BOOST_PRAGMA_MESSAGE(x)
-#endif
-
-#endif // BOOST_CONFIG_PRAGMA_MESSAGE_HPP_INCLUDED
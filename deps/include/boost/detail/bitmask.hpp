@@ -1,58 +0,0 @@
-//  boost/detail/bitmask.hpp  ------------------------------------------------//
-
-//  Copyright Beman Dawes 2006
-
-//  Distributed under the Boost Software License, Version 1.0
-//  http://www.boost.org/LICENSE_1_0.txt
-
-//  Usage:  enum foo { a=1, b=2, c=4 };
-//          BOOST_BITMASK( foo )
-//
-//          void f( foo arg );
-//          ...
-//          f( a | c );
-//
-//  See [bitmask.types] in the C++ standard for the formal specification
-
-#ifndef BOOST_BITMASK_HPP
-#define BOOST_BITMASK_HPP
-
-#include <boost/config.hpp>
-#include <boost/cstdint.hpp>
-
-#define BOOST_BITMASK(Bitmask)                                            \
-                                                                          \
-  inline BOOST_CONSTEXPR Bitmask operator| (Bitmask x , Bitmask y )       \
-  { return static_cast<Bitmask>( static_cast<boost::int_least32_t>(x)     \
-      | static_cast<boost::int_least32_t>(y)); }                          \
-                                                                          \
-  inline BOOST_CONSTEXPR Bitmask operator& (Bitmask x , Bitmask y )       \
-  { return static_cast<Bitmask>( static_cast<boost::int_least32_t>(x)     \
-      & static_cast<boost::int_least32_t>(y)); }                          \
-                                                                          \
-  inline BOOST_CONSTEXPR Bitmask operator^ (Bitmask x , Bitmask y )       \
-  { return static_cast<Bitmask>( static_cast<boost::int_least32_t>(x)     \
-      ^ static_cast<boost::int_least32_t>(y)); }                          \
-                                                                          \
-  inline BOOST_CONSTEXPR Bitmask operator~ (Bitmask x )                   \
-  { return static_cast<Bitmask>(~static_cast<boost::int_least32_t>(x)); } \
-                                                                          \
-  inline Bitmask & operator&=(Bitmask& x , Bitmask y)                     \
-  { x = x & y ; return x ; }                                              \
-                                                                          \
-  inline Bitmask & operator|=(Bitmask& x , Bitmask y)                     \
-  { x = x | y ; return x ; }                                              \
-                                                                          \
-  inline Bitmask & operator^=(Bitmask& x , Bitmask y)                     \
-  { x = x ^ y ; return x ; }                                              \
-                                                                          \
-  /* Boost extensions to [bitmask.types] */                               \
-                                                                          \
-  inline BOOST_CONSTEXPR bool operator!(Bitmask x)                        \
-  { return !static_cast<int>(x); }                                        \
-                                                                          \
-  inline BOOST_CONSTEXPR bool bitmask_set(Bitmask x)                      \
-  { return !!x; }
-
-#endif // BOOST_BITMASK_HPP
-
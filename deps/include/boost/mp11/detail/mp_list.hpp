@@ -1,24 +0,0 @@
-#ifndef BOOST_MP11_DETAIL_MP_LIST_HPP_INCLUDED
-#define BOOST_MP11_DETAIL_MP_LIST_HPP_INCLUDED
-
-//  Copyright 2015, 2016 Peter Dimov.
-//
-//  Distributed under the Boost Software License, Version 1.0.
-//
-//  See accompanying file LICENSE_1_0.txt or copy at
-//  http://www.boost.org/LICENSE_1_0.txt
-
-namespace boost
-{
-namespace mp11
-{
-
-// mp_list<T...>
-template<class... T> struct mp_list
-{
-};
-
-} // namespace mp11
-} // namespace boost
-
-#endif // #ifndef BOOST_MP11_DETAIL_MP_LIST_HPP_INCLUDED
@@ -1,18 +0,0 @@
-# /* **************************************************************************
-#  *                                                                          *
-#  *     (C) Copyright Paul Mensonides 2002.
-#  *     Distributed under the Boost Software License, Version 1.0. (See
-#  *     accompanying file LICENSE_1_0.txt or copy at
-#  *     http://www.boost.org/LICENSE_1_0.txt)
-#  *                                                                          *
-#  ************************************************************************** */
-#
-# /* See http://www.boost.org for most recent version. */
-#
-# ifndef BOOST_PREPROCESSOR_SELECTION_HPP
-# define BOOST_PREPROCESSOR_SELECTION_HPP
-#
-# include <boost/preprocessor/selection/max.hpp>
-# include <boost/preprocessor/selection/min.hpp>
-#
-# endif
@@ -1,15 +0,0 @@
-//  (C) Copyright Dave Abrahams, Steve Cleary, Beman Dawes, Howard
-//  Hinnant & John Maddock 2000.  
-//  Use, modification and distribution are subject to the Boost Software License,
-//  Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
-//  http://www.boost.org/LICENSE_1_0.txt).
-//
-//  See http://www.boost.org/libs/type_traits for most recent version including documentation.
-
-
-#ifndef BOOST_TT_ARRAY_TRAITS_HPP_INCLUDED
-#define BOOST_TT_ARRAY_TRAITS_HPP_INCLUDED
-
-#include <boost/type_traits/is_array.hpp>
-
-#endif // BOOST_TT_ARRAY_TRAITS_HPP_INCLUDED
@@ -1,25 +0,0 @@
-/*
-Copyright 2017-2018 Glen Joseph Fernandes
-(glenjofe@gmail.com)
-
-Distributed under the Boost Software License,
-Version 1.0. (See accompanying file LICENSE_1_0.txt
-or copy at http://www.boost.org/LICENSE_1_0.txt)
-*/
-
-#ifndef BOOST_TT_DETECTED_OR_HPP_INCLUDED
-#define BOOST_TT_DETECTED_OR_HPP_INCLUDED
-
-#include <boost/type_traits/detail/detector.hpp>
-
-namespace boost {
-
-template<class Default, template<class...> class Op, class... Args>
-using detected_or = detail::detector<Default, void, Op, Args...>;
-
-template<class Default, template<class...> class Op, class... Args>
-using detected_or_t = typename detected_or<Default, Op, Args...>::type;
-
-} /* boost */
-
-#endif
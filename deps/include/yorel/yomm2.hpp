@@ -1,21 +0,0 @@
-// Copyright (c) 2018-2022 Jean-Louis Leroy
-// Distributed under the Boost Software License, Version 1.0.
-// See accompanying file LICENSE_1_0.txt
-// or copy at http://www.boost.org/LICENSE_1_0.txt)
-
-#ifndef YOREL_YOMM2_INCLUDED
-#define YOREL_YOMM2_INCLUDED
-
-#include <algorithm> // IWYU pragma: keep
-#include <cassert>
-#include <iostream>
-#include <iterator> // IWYU pragma: keep
-#include <type_traits>
-#include <typeinfo>
-#include <unordered_set>
-#include <utility>
-
-#include <yorel/yomm2/core.hpp>
-#include <yorel/yomm2/macros.hpp>
-
-#endif
@@ -1,23 +0,0 @@
-// Copyright (c) 2018-2021 Jean-Louis Leroy
-// Distributed under the Boost Software License, Version 1.0.
-// See accompanying file LICENSE_1_0.txt
-// or copy at http://www.boost.org/LICENSE_1_0.txt)
-
-#ifndef YOREL_YOMM2_CUTE_INCLUDED
-#define YOREL_YOMM2_CUTE_INCLUDED
-
-#include <yorel/yomm2.hpp>
-
-#define register_class YOMM2_CLASS
-#define register_classes YOMM2_CLASSES
-
-#define declare_method YOMM2_DECLARE
-#define declare_static_method YOMM2_STATIC_DECLARE
-#define define_method YOMM2_DEFINE
-#define define_method_inline YOMM2_DEFINE_INLINE
-
-#define method_container YOMM2_DECLARE_METHOD_CONTAINER
-#define friend_method YOMM2_FRIEND
-#define method_definition YOMM2_DEFINITION
-
-#endif
@@ -1,9 +0,0 @@
-#ifndef YOREL_YOMM2_KEYWORDS_INCLUDED
-#define YOREL_YOMM2_KEYWORDS_INCLUDED
-
-#include <yorel/yomm2/core.hpp>
-#include <yorel/yomm2/cute.hpp>
-
-using ::yorel::yomm2::virtual_;
-
-#endif
\ No newline at end of file
@@ -0,0 +1,334 @@
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef _WIN32
+    #include <windows.h>
+    #include <psapi.h>
+#else
+    #include <sys/resource.h>
+#endif
+
+#include "core/Interpreter.hpp"
+#include "core/Lexer.hpp"
+#include "core/Parser.hpp"
+#include "core/Resolver.hpp"
+#include "core/Statement.hpp"
+#include "core/VM.hpp"
+
+// Throughput benchmark for the lexer, parser and interpreter. Each synthetic
+// corpus is lexed with Lexer::Parse, parsed with Parser::Parse (the parse time
+// includes resolving scopes) and run both through
+// Interpreter::ExecuteTopContext, which reports statements run, and on the
+// VM, which is only timed. Results are printed to stdout as JSON. Peak RSS is only known for the whole process, so measuring one
+// corpus's memory takes a run with just that corpus.
+//
+// Usage: dxsh_bench [--size=MiB per corpus, default 2] [corpus name]...
+// Corpora: expressions, functions, strings, comments (all by default)
+
+using namespace dxsh;
+using namespace core;
+
+using Clock = std::chrono::steady_clock;
+
+static double SecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+static std::size_t PeakRssKiB() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters{};
+    GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+    return counters.PeakWorkingSetSize / 1024;
+#else
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+
+    #ifdef __APPLE__
+        return static_cast<std::size_t>(usage.ru_maxrss) / 1024; // Bytes on macOS
+    #else
+        return static_cast<std::size_t>(usage.ru_maxrss);
+    #endif
+#endif
+}
+
+// Random nested arithmetic, one variable per line
+static std::string MakeExpressions(std::size_t bytes, std::mt19937& rng) {
+    std::uniform_int_distribution<int> digit(1, 9);
+    std::uniform_int_distribution<int> choice(0, 9);
+
+    auto expr = [&](auto& self, int depth) -> std::string {
+        if (depth == 0 || choice(rng) == 0) {
+            static constexpr std::string_view vars[] = { "a", "b", "c" };
+            return choice(rng) < 3 ? std::string(vars[choice(rng) % 3]) : std::to_string(digit(rng));
+        }
+
+        switch (choice(rng)) {
+            case 0:  return std::format("-{}", self(self, depth - 1));
+            case 1:  return std::format("{} * {}", digit(rng), self(self, depth - 1));
+            case 2:
+            case 3:  return std::format("({} - {})", self(self, depth - 1), self(self, depth - 1));
+            default: return std::format("({} + {})", self(self, depth - 1), self(self, depth - 1));
+        }
+    };
+
+    std::string corpus = "var a = 1;\nvar b = 2;\nvar c = 3;\n";
+
+    for (std::size_t i = 0; corpus.size() < bytes; i++) {
+        corpus += std::format("var e_{} = {};\n", i, expr(expr, 8));
+    }
+
+    return corpus;
+}
+
+// Many small functions, each called once
+static std::string MakeFunctions(std::size_t bytes, std::mt19937& rng) {
+    std::uniform_int_distribution<int> digit(0, 9);
+
+    std::string corpus;
+
+    for (std::size_t i = 0; corpus.size() < bytes; i++) {
+        corpus += std::format(
+              "func f_{0}(x, y) {{\n"
+              "    var t = x + y * {1};\n"
+              "    if (t > {2}) {{\n"
+              "        return t - y;\n"
+              "    }} else {{\n"
+              "        t = t + 1;\n"
+              "    }}\n"
+              "    return t;\n"
+              "}}\n"
+              "var r_{0} = f_{0}({3}, {4});\n"
+            , i, digit(rng), digit(rng) * 3, digit(rng), digit(rng)
+        );
+    }
+
+    return corpus;
+}
+
+// Long string literals, some spanning lines, occasionally printed
+static std::string MakeStrings(std::size_t bytes, std::mt19937& rng) {
+    static constexpr std::string_view words[] = {
+        "lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "adipiscing", "elit"
+    };
+
+    std::uniform_int_distribution<std::size_t> word(0, std::size(words) - 1);
+    std::uniform_int_distribution<int> length(128, 4096);
+    std::uniform_int_distribution<int> choice(0, 15);
+
+    std::string corpus;
+
+    for (std::size_t i = 0; corpus.size() < bytes; i++) {
+        std::string text;
+
+        for (int target = length(rng); static_cast<int>(text.size()) < target; ) {
+            text += words[word(rng)];
+            text += choice(rng) == 0 ? '\n' : ' ';
+        }
+
+        corpus += std::format("var s_{} = \"{}\";\n", i, text);
+
+        if (choice(rng) == 0)
+            corpus += std::format("print s_{};\n", i);
+    }
+
+    return corpus;
+}
+
+// Runs of line comments between short statements
+static std::string MakeComments(std::size_t bytes, std::mt19937& rng) {
+    std::uniform_int_distribution<int> lines(1, 16);
+    std::uniform_int_distribution<int> width(16, 120);
+
+    std::string corpus;
+
+    for (std::size_t i = 0; corpus.size() < bytes; i++) {
+        for (int line = lines(rng); line > 0; line--) {
+            corpus += "// ";
+            corpus.append(width(rng), '-');
+            corpus += " \"quoted\" // nested\n";
+        }
+
+        corpus += std::format("var c_{} = {} + 1;\n", i, i % 1000);
+    }
+
+    return corpus;
+}
+
+struct Corpus {
+    std::string_view name;
+    std::string (*make)(std::size_t bytes, std::mt19937& rng);
+};
+
+static constexpr Corpus corpora[] = {
+      { "expressions", MakeExpressions }
+    , { "functions",   MakeFunctions }
+    , { "strings",     MakeStrings }
+    , { "comments",    MakeComments }
+};
+
+// Prints the errors and returns false if there are any
+static bool CheckErrors(std::string_view corpus, std::string_view stage, const ErrorContext& errors) {
+    for (const Error& error : errors) {
+        std::cerr << std::format("{}: {} error on line {}: {}\n", corpus, stage, error.line, error.message);
+    }
+
+    return errors.empty();
+}
+
+// Returns the JSON object for one corpus, or nothing if it failed
+static std::optional<std::string> RunCorpus(const Corpus& corpus, std::size_t bytes) {
+    std::mt19937 rng(42);
+    const std::string source = corpus.make(bytes, rng);
+
+    Interpreter interpreter;
+    ErrorContext errors;
+
+    // Lexing
+    Lexer lexer(errors, interpreter.symbols);
+
+    auto lexStart = Clock::now();
+    const TokenBuffer tokens = lexer.Parse(source);
+    double lexSeconds = SecondsSince(lexStart);
+
+    if (not CheckErrors(corpus.name, "lex", errors))
+        return std::nullopt;
+
+    // Parsing
+    Program program;
+    Parser parser(errors, program);
+
+    auto parseStart = Clock::now();
+    const auto statements = parser.Parse(tokens);
+    ResolveScopes(program, statements);
+    double parseSeconds = SecondsSince(parseStart);
+
+    if (not CheckErrors(corpus.name, "parse", errors))
+        return std::nullopt;
+
+    std::size_t nodes = program.NodeCount();
+
+    // Execution, running to completion
+    bool failed = false;
+
+    interpreter.SetYieldBudget({ .statements = 0 });
+    interpreter.LoadProgram(program, statements);
+    interpreter.LoadInterface([&]() {
+        for (auto res : interpreter.ExecuteTopContext()) {
+            switch (res) {
+                case RuntimeStatus::RanStatement:
+                    interpreter.TakeOutput();
+                    break;
+                case RuntimeStatus::ClosedContext:
+                    return;
+                case RuntimeStatus::Error:
+                    failed = true;
+                    return;
+            }
+        }
+    });
+
+    auto runStart = Clock::now();
+    interpreter.RunInterface();
+    double runSeconds = SecondsSince(runStart);
+
+    // Statements run at every call depth
+    const std::size_t ran = interpreter.StatementsRun();
+
+    if (failed) {
+        CheckErrors(corpus.name, "runtime", interpreter.errors);
+        return std::nullopt;
+    }
+
+    // The same statements compiled and run on the VM, the default engine. It
+    // has no statements to count, so only its time is reported.
+    VM vm(program, interpreter.symbols);
+    vm.SetYieldBudget({ .statements = 0 });
+
+    auto vmStart = Clock::now();
+    const bool succeeded = vm.Run(statements);
+    double vmSeconds = SecondsSince(vmStart);
+
+    vm.TakeOutput();
+
+    if (not succeeded) {
+        CheckErrors(corpus.name, "VM runtime", vm.errors);
+        return std::nullopt;
+    }
+
+    return std::format(
+          "    {{\n"
+          "      \"name\": \"{}\",\n"
+          "      \"bytes\": {},\n"
+          "      \"tokens\": {},\n"
+          "      \"nodes\": {},\n"
+          "      \"statements\": {},\n"
+          "      \"lexSeconds\": {:.6f},\n"
+          "      \"parseSeconds\": {:.6f},\n"
+          "      \"runSeconds\": {:.6f},\n"
+          "      \"tokensPerSecond\": {:.0f},\n"
+          "      \"nodesPerSecond\": {:.0f},\n"
+          "      \"statementsPerSecond\": {:.0f},\n"
+          "      \"vmRunSeconds\": {:.6f}\n"
+          "    }}"
+        , corpus.name, source.size(), tokens.Size(), nodes, ran
+        , lexSeconds, parseSeconds, runSeconds
+        , tokens.Size() / lexSeconds, nodes / parseSeconds, ran / runSeconds
+        , vmSeconds
+    );
+}
+
+int main(int argc, char** argv) {
+    std::size_t mib = 2;
+    std::vector<const Corpus*> selected;
+
+    for (std::string_view arg : std::span(argv + 1, argc - 1)) {
+        if (arg.starts_with("--size=")) {
+            mib = std::stoul(std::string(arg.substr(arg.find('=') + 1)));
+            continue;
+        }
+
+        auto it = std::ranges::find(corpora, arg, &Corpus::name);
+
+        if (it == std::end(corpora)) {
+            std::cerr << std::format("Unknown corpus '{}'\n", arg);
+            return 1;
+        }
+
+        selected.push_back(&*it);
+    }
+
+    if (selected.empty()) {
+        for (const Corpus& corpus : corpora) {
+            selected.push_back(&corpus);
+        }
+    }
+
+    std::string results;
+
+    for (const Corpus* corpus : selected) {
+        auto result = RunCorpus(*corpus, mib * 1024 * 1024);
+
+        if (not result)
+            return 1;
+
+        results += results.empty() ? "" : ",\n";
+        results += *result;
+    }
+
+    std::cout << std::format(
+          "{{\n"
+          "  \"sizeMiB\": {},\n"
+          "  \"corpora\": [\n{}\n  ],\n"
+          "  \"peakRssKiB\": {}\n"
+          "}}\n"
+        , mib, results, PeakRssKiB()
+    );
+}
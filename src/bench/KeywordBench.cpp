@@ -0,0 +1,124 @@
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "core/Lexer.hpp"
+#include "core/Tokens.hpp"
+
+// Microbenchmark for keyword recognition on identifier-heavy sources.
+// Compares GetPotentialKeywordTokenType against the hash map lookup it
+// replaced, then reports end-to-end lexing throughput.
+//
+// Usage: dxsh_keyword_bench [corpus size in MiB, default 16]
+
+using namespace dxsh;
+using namespace core;
+
+using Clock = std::chrono::steady_clock;
+
+static const std::unordered_map<std::string_view, TokenType> mapKeywords = {
+      { "and",      TokenType::And }
+    , { "or",       TokenType::Or }
+    , { "not",      TokenType::Not }
+    , { "print",    TokenType::Print }
+    , { "true",     TokenType::True }
+    , { "false",    TokenType::False }
+    , { "for",      TokenType::For }
+    , { "if",       TokenType::If }
+    , { "else",     TokenType::Else }
+    , { "while",    TokenType::While }
+    , { "func",     TokenType::Function }
+    , { "return",   TokenType::Return }
+    , { "var",      TokenType::Var }
+    , { "null",     TokenType::Null }
+};
+
+static TokenType MapLookup(std::string_view lexeme) {
+    auto it = mapKeywords.find(lexeme);
+    return it != mapKeywords.end() ? it->second : TokenType::Identifier;
+}
+
+// Lines of the form "var name_1 = other_2 + third_3;" with a sprinkling of keywords
+static std::string MakeCorpus(std::size_t bytes) {
+    static constexpr std::string_view stems[] = {
+        "count", "index", "value", "total", "name", "node", "left", "right",
+        "result", "buffer", "offset", "length", "item", "key", "acc", "x"
+    };
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<std::size_t> stem(0, std::size(stems) - 1);
+    std::uniform_int_distribution<int> suffix(0, 999);
+
+    auto ident = [&]() { return std::format("{}_{}", stems[stem(rng)], suffix(rng)); };
+
+    std::string corpus;
+    corpus.reserve(bytes + 128);
+
+    while (corpus.size() < bytes) {
+        corpus += std::format("var {} = {} + {} * {};\n", ident(), ident(), ident(), ident());
+
+        if (suffix(rng) < 100)
+            corpus += std::format("if ({} and not {}) return {};\n", ident(), ident(), ident());
+    }
+
+    return corpus;
+}
+
+template<typename F>
+static double TimeLookups(const std::vector<std::string_view>& lexemes, F lookup, std::size_t& keywords) {
+    auto start = Clock::now();
+
+    keywords = 0;
+
+    for (std::string_view lexeme : lexemes) {
+        keywords += lookup(lexeme) != TokenType::Identifier;
+    }
+
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+    std::size_t mib = argc > 1 ? std::stoul(argv[1]) : 16;
+    std::string corpus = MakeCorpus(mib * 1024 * 1024);
+
+    ErrorContext errors;
+    SymbolTable symbols;
+    Lexer lexer(errors, symbols);
+
+    auto lexStart = Clock::now();
+    TokenBuffer tokens = lexer.Parse(corpus);
+    double lexSeconds = std::chrono::duration<double>(Clock::now() - lexStart).count();
+
+    // Every word-like token, keywords included, goes through keyword recognition
+    std::vector<std::string_view> lexemes;
+
+    for (std::size_t i = 0; i < tokens.Size(); i++) {
+        TokenType type = tokens.GetType(i);
+
+        if (type == TokenType::Identifier || GetTokenClass(type) == TokenClass::Keyword
+            || GetTokenClass(type) == TokenClass::Logic || type == TokenType::Print) {
+            lexemes.push_back(tokens.GetLexeme(i));
+        }
+    }
+
+    std::size_t mapKeywordsFound{}, hashKeywordsFound{};
+    double mapSeconds  = TimeLookups(lexemes, MapLookup, mapKeywordsFound);
+    double hashSeconds = TimeLookups(lexemes, GetPotentialKeywordTokenType, hashKeywordsFound);
+
+    if (mapKeywordsFound != hashKeywordsFound) {
+        std::cerr << std::format("Mismatch: map found {} keywords, hash found {}\n", mapKeywordsFound, hashKeywordsFound);
+        return 1;
+    }
+
+    double lookups = static_cast<double>(lexemes.size());
+
+    std::cout << std::format("corpus:        {} MiB, {} tokens, {} words ({} keywords)\n"
+        , mib, tokens.Size(), lexemes.size(), hashKeywordsFound);
+    std::cout << std::format("map lookup:    {:.2f} ns/word\n", mapSeconds * 1e9 / lookups);
+    std::cout << std::format("perfect hash:  {:.2f} ns/word ({:.1f}x)\n", hashSeconds * 1e9 / lookups, mapSeconds / hashSeconds);
+    std::cout << std::format("lexing:        {:.1f} MiB/s\n", mib / lexSeconds);
+}
@@ -1,305 +1,82 @@
+#include <algorithm>
+#include <span>
 #include <stdexcept>
 #include <utility>
 #include "core/AstMethods/Evaluate.hpp"
 #include "core/Environment.hpp"
 #include "core/Error.hpp"
-#include "core/Interpreter.hpp" // Needed to recurse back to top from call expressions
+#include "core/Interpreter.hpp" // Needed to push steps and contexts for calls
+#include "core/Operators.hpp"
+#include "core/Program.hpp"
 #include "core/Value.hpp"
 #include "magic_enum/magic_enum.hpp"
 
 using namespace dxsh;
 using namespace core;
 
-enum class UnaryConversionTarget { Numeric, Boolean };
+// Reads the variable the last evaluated child refers to, if it is an lvalue.
+// Each child is read before the next one runs, which may assign to it.
+static void ExtractOperand(Interpreter* interp) {
+    Value& operand = interp->Operand();
 
-struct BinaryConversionResult {
-    Value left, right;
-};
-
-static std::optional<BinaryConversionResult> NumericConversion(const Value& left, const Value& right) {
-    using Res = BinaryConversionResult;
-    using enum ValueType;
-
-    ValueType typeL = left.GetType();
-    ValueType typeR = right.GetType();
-
-    // Only support arithmetic operations on int, float
-    if (not left.IsArithmetic() || not right.IsArithmetic())
-        return std::nullopt;
-
-    // No conversion necessary
-    if (typeL == typeR)
-        return Res{ left, right };
-
-    // Two options remaining - either left is an int, or right is an int, and it needs
-    // to be converted to a float
-    if (typeL == Integer) {
-        return Res{
-              .left = static_cast<float>(left.GetAs<int>())
-            , .right = right
-        };
-    }
-
-    if (typeR == Integer) {
-        return Res{
-              .left = left
-            , .right = static_cast<float>(right.GetAs<int>())
-        };
-    }
-    
-    return std::nullopt; // Should not be reachable
+    if (operand.GetType() == ValueType::Lvalue)
+        operand = Value(interp->GetCurEnvironment().ExtractFromLV(operand));
 }
 
-template<UnaryConversionTarget Target>
-static std::optional<Value> UnaryConversion(const Value& value) {
-    if constexpr (Target == UnaryConversionTarget::Numeric) {
-        if (value.GetType() != ValueType::Integer && value.GetType() != ValueType::Decimal) {
-            return value;
-        }
+// Operators throw errors without a line, which is looked up only once one is thrown
+template<typename Apply>
+static Value AtLineOf(ExprId id, Interpreter* interp, Apply&& apply) {
+    try {
+        return apply();
+    } catch (Error& e) {
+        e.line = interp->GetProgram().GetLine(id);
+        throw;
     }
 }
 
-// Assumes left and right are the same type
-// Only operates on Arithmetic or Comparison operator classes
-// Accepts integer, floating, and strings
-static Value EvaluateBinaryExpr(const Value& left, const Value& right, const Token& op) {
-    using enum TokenType;
-
-    auto eval = [&]<typename T>() -> std::variant<T, bool> {
-        const T& l = left.GetAs<T>();
-        const T& r = right.GetAs<T>();
-    
-        // Special case the operations that aren't valid for strings
-        if constexpr (not std::same_as<T, std::string>) {
-            switch (op.type) {
-                // Arithmetic
-                case Minus: return l - r;
-                case Star:  return l * r;
-                case Slash: return l / r;
-                case StarStar: // Exponent
-                    if constexpr (std::same_as<T, int>) {
-                        if (r == 0) return 1; // 0^0 == 1
-                        if (r == 1) return l;
-                        if (l == 0) return 0;
-
-                        int val = l;
-
-                        for (int i = 1; i < r; i++) {
-                            val *= l;
-                        }
-
-                        return l;
-                    } else {
-                        return std::powf(l, r);
-                    }
-                default: ; // Fallthrough to next switch statement
-            }
-        }
-        
-        switch (op.type) {
-            case Plus:  return l + r;
-            // Comparison
-            case Greater:      return l > r;
-            case GreaterEqual: return l >= r;
-            case Less:         return l < r;
-            case LessEqual:    return l <= r;
-            default:
-                throw Error{
-                      .line = op.line
-                    , .message = std::format(
-                          "Invalid binary operator {} for types {} and {}"
-                        , op.GetRepresentation()
-                        , magic_enum::enum_name(left.GetType())
-                        , magic_enum::enum_name(right.GetType())
-                    )
-                };
-        }
-    };
-
-    if (left.GetType() == ValueType::Integer) {
-        if (GetTokenClass(op.type) == TokenClass::Arithmetic)
-            return std::get<int>(eval.operator()<int>());
-        else
-            return std::get<bool>(eval.operator()<int>());
-    } else if (left.GetType() == ValueType::Decimal) {
-        if (GetTokenClass(op.type) == TokenClass::Arithmetic)
-            return std::get<float>(eval.operator()<float>());
-        else
-            return std::get<bool>(eval.operator()<float>());
-    } else if (left.GetType() == ValueType::String) {
-        if (GetTokenClass(op.type) == TokenClass::Arithmetic)
-            return std::get<std::string>(eval.operator()<std::string>());
-        else
-            return std::get<bool>(eval.operator()<std::string>());
+static void Evaluate(BinaryExpr expr, const Step& step, Interpreter* interp) {
+    switch (step.stage) {
+        case 0:
+            if (not interp->Then(expr.left))
+                return;
+            [[fallthrough]];
+        case 1:
+            ExtractOperand(interp);
+
+            if (not interp->Then(expr.right))
+                return;
     }
 
-    throw std::runtime_error(
-        std::format(
-              "Unexpectedly reached end of EvaluateBinaryExpr. {} {} {}"
-            , magic_enum::enum_name(left.GetType())
-            , op.GetRepresentation()
-            , magic_enum::enum_name(right.GetType())
-        )
-    );
-}
+    ExtractOperand(interp);
+    const Value right = interp->PopOperand();
+    const Value left = interp->PopOperand();
 
-static bool EvaluateEquality(const Value& left, const Value& right, const Token& op) {
-    using enum ValueType;
-
-    ValueType leftT = left.GetType();
-    ValueType rightT = right.GetType();
-
-    // IILE to deal with == vs != in a concise way
-    bool result = [&]() {
-        if (leftT == rightT) {
-            switch (leftT) {
-                case Integer:    return left.GetAs<int>() == right.GetAs<int>();
-                case Decimal:    return left.GetAs<float>() == right.GetAs<float>();
-                case String:     return left.GetAs<std::string>() == right.GetAs<std::string>();
-                case Boolean:    return left.GetAs<bool>() == right.GetAs<bool>();
-                case Null:       return true;
-                case Lvalue:     throw std::runtime_error("Unextracted lvalue in equality");
-                case Function:   throw std::runtime_error("Function unhandled in equality");
-            }
-        }
-
-        // Handle the case of two different types being compared
-        if (leftT == Null || rightT == Null)
-            return false;
-
-        // Perform an implicit int->float conversion
-        if (left.IsArithmetic() && right.IsArithmetic()) {
-            auto res = NumericConversion(left, right);
-
-            return res->left.GetAs<float>() == res->right.GetAs<float>();
-        }
-
-        // Incomparable types
-        throw Error{
-              .line = op.line
-            , .message = std::format(
-                  "Invalid '{}' comparison of types {} and {}"
-                , op.GetRepresentation()
-                , magic_enum::enum_name(leftT)
-                , magic_enum::enum_name(rightT)
-            )
-        };
-    }();
-
-    // Invert the result if it's a !=
-    return result ^ (op.type == TokenType::BangEqual);
+    interp->Finish(AtLineOf(step.expr, interp, [&]() { return ApplyBinary(left, right, expr.op); }));
 }
 
-static Error BinaryConversionError(std::string_view name, const Token& op, const Value& left, const Value& right) {
-    return Error{
-          .line = op.line
-        , .message = std::format(
-              "Can't perform {} for '{}' between types {} and {}"
-            , name
-            , op.GetRepresentation()
-            , magic_enum::enum_name(left.GetType())
-            , magic_enum::enum_name(right.GetType())
-        )
-    };
-}
+static void Evaluate(UnaryExpr expr, const Step& step, Interpreter* interp) {
+    if (step.stage == 0 && not interp->Then(expr.operand))
+        return;
 
-declare_method(Value, Evaluate, (virtual_<const Expr&>, Interpreter*));
+    ExtractOperand(interp);
+    const Value operand = interp->PopOperand();
 
-define_method(Value, Evaluate, (const BinaryExpr& expr, Interpreter* interp)) {
-    using enum TokenClass;
-
-    auto& env = interp->GetCurEnvironment();
-    Value left = env.ExtractFromLV(::Evaluate(*expr.left, interp));
-    Value right = env.ExtractFromLV(::Evaluate(*expr.right, interp));
-
-    // Special case equality to its own function
-    if (expr.op.type == TokenType::EqualEqual || expr.op.type == TokenType::BangEqual) {
-        return EvaluateEquality(left, right, expr.op);
-    }
-
-    switch (GetTokenClass(expr.op.type)) {
-        case Arithmetic:
-        case Comparison: {
-            if (left.GetType() == ValueType::String && right.GetType() == ValueType::String) {
-                // Support for binary expressions between strings
-                return EvaluateBinaryExpr(left, right, expr.op);
-            } else {
-                // Support for binary expressions between numbers
-                auto res = NumericConversion(left, right);
-
-                if (not res)
-                    throw BinaryConversionError("numeric conversion", expr.op, left, right);
-
-                return EvaluateBinaryExpr(res->left, res->right, expr.op);
-            }
-        }
-        default:
-            throw std::runtime_error(std::format(
-                "Invalid binary operator {}", expr.op.GetRepresentation()
-            ));
-    }
-}
-
-define_method(Value, Evaluate, (const UnaryExpr& expr, Interpreter* interp)) {
-    using enum TokenType;
-
-    auto& env = interp->GetCurEnvironment();
-    const Value operand = env.ExtractFromLV(::Evaluate(*expr.operand, interp));
-
-    switch (expr.op.type) {
-        case Minus: {
-            if (not operand.IsArithmetic()) {
-                throw Error{
-                      .line = expr.op.line
-                    , .message = std::format(
-                          "Expected numeric operand for '-'. Got {}"
-                        , magic_enum::enum_name(operand.GetType())
-                    )
-                };
-            }
-
-            Token multToken = expr.op;
-            multToken.type = Star;
-
-            return EvaluateBinaryExpr(-1, operand, multToken);
-        } 
-        case Not: {
-            if (operand.GetType() != ValueType::Boolean) {
-                throw Error{
-                      .line = expr.op.line
-                    , .message = std::format(
-                          "Expected boolean operand for 'not'. Got {}"
-                        , magic_enum::enum_name(operand.GetType())
-                    )
-                };
-            }
-
-            return not operand.GetAs<bool>();
-        }
-        default:
-            throw std::runtime_error(std::format(
-                  "Invalid unary operator {}"
-                , expr.op.GetRepresentation()
-            ));
-    }
+    interp->Finish(AtLineOf(step.expr, interp, [&]() { return ApplyUnary(operand, expr.op); }));
 }
 
-define_method(Value, Evaluate, (const GroupingExpr&, Interpreter*)) {
-    throw std::runtime_error("GroupingExpr unused");
-    // return Evaluate(*expr.expr, env);
+static void Evaluate(GroupingExpr expr, const Step&, Interpreter* interp) {
+    interp->Replace(expr.expr);
 }
 
-define_method(Value, Evaluate, (const LiteralExpr& expr, Interpreter*)) {
-    return expr.value;
+static void Evaluate(const LiteralExpr& expr, const Step&, Interpreter* interp) {
+    interp->Finish(expr.value);
 }
 
-define_method(Value, Evaluate, (const AssignmentExpr& expr, Interpreter* interp)) {
-    auto& env = interp->GetCurEnvironment();
-    Value target = ::Evaluate(*expr.target, interp);
-
+// Variable an assignment's target refers to
+static VarDecl& FindTarget(const Value& target, int line, Interpreter* interp) {
     if (auto type = target.GetType(); type != ValueType::Lvalue) {
         throw Error{
-              .line = expr.equal.line
+              .line = line
             , .message = std::format(
                   "Expected lvalue for assignment target, got {} instead"
                 , magic_enum::enum_name(type)
@@ -308,26 +85,44 @@ define_method(Value, Evaluate, (const AssignmentExpr& expr, Interpreter* interp)
     }
 
     const Lvalue& lvalue = target.GetAs<Lvalue>();
-    VarDecl* var = env.GetVar(lvalue.name);
+    VarDecl* var = interp->GetCurEnvironment().GetVar(lvalue);
     
     if (var == nullptr)
         throw UndefinedVariableError(lvalue.lineOfRef, lvalue.name);
 
-    const Value rvalue = env.ExtractFromLV(::Evaluate(*expr.value, interp));
-    var->Set(rvalue, expr.equal.line);
-
-    return rvalue;
+    return *var;
 }
 
-define_method(Value, Evaluate, (const CallExpr& call, Interpreter* interp)) {
-    auto& env = interp->GetCurEnvironment();
+static void Evaluate(AssignmentExpr expr, const Step& step, Interpreter* interp) {
+    const int line = interp->GetProgram().GetLine(step.expr);
+
+    // The target has to exist before the value is evaluated
+    switch (step.stage) {
+        case 0:
+            if (not interp->Then(expr.target))
+                return;
+            [[fallthrough]];
+        case 1:
+            FindTarget(interp->Operand(), line, interp);
 
-    // Evaluate the function we're actually calling
-    Value val = env.ExtractFromLV(::Evaluate(*call.function, interp));
+            if (not interp->Then(expr.value))
+                return;
+    }
 
+    ExtractOperand(interp);
+    const Value rvalue = interp->PopOperand();
+    const Value target = interp->PopOperand();
+
+    // Looked up again, as calls made by the value may have moved it
+    FindTarget(target, line, interp).Set(rvalue, line);
+    interp->Finish(rvalue);
+}
+
+// Checks that the function of a call, once evaluated, can be called with its arguments
+static void CheckCallee(const Value& val, CallExpr call, ExprId id, Interpreter* interp) {
     if (val.GetType() != ValueType::Function) {
         throw Error{
-              .line = call.parenL.line
+              .line = interp->GetProgram().GetLine(id)
             , .message = std::format(
                   "Attempt to treat {} as function in call expression"
                 , val.ToPrettyString()
@@ -340,7 +135,7 @@ define_method(Value, Evaluate, (const CallExpr& call, Interpreter* interp)) {
     // Check that the arity (num of params) matches
     if (function.Arity() != call.args.size()) {
         throw Error{
-              .line = call.parenL.line
+              .line = interp->GetProgram().GetLine(id)
             , .message = std::format(
                   "Number of arguments ({}) to function call does not match number of parameters ({})."
                   "\nNote: Function defined on line {}."
@@ -348,29 +143,131 @@ define_method(Value, Evaluate, (const CallExpr& call, Interpreter* interp)) {
             )
         };
     }
+}
+
+// Pushes the context of a call, which runs next in the same loop as its caller
+static void Call(const Function& function, std::span<const Value> args, int line, Interpreter* interp) {
+    // Its body has to be parsed before its slots are known
+    const StatementList body = interp->GetFunctionBody(function);
+    const IndexRange<Symbol> slots = interp->GetProgram().funcStmts[function.definition].slots;
+    auto& ctx = interp->PushContext(ContextType::Function, body, slots.size(), line);
+
+    // Populate the parameters with values, which take the first slots
+    const auto params = interp->GetProgram().Get(function.params);
+
+    for (std::size_t i = 0; i < function.Arity(); i++) {
+        const Binding param{ .kind = Binding::Kind::Local, .slot = static_cast<std::uint32_t>(i) };
+        ctx.environment.CreateOrAssignVar(param, params[i], args[i], function.line);
+    }
+}
+
+static void Evaluate(CallExpr call, const Step& step, Interpreter* interp) {
+    const std::size_t argc = call.args.size();
 
-    // Evaluate the arguments from left to right
-    std::vector<Value> argVals;
-    argVals.reserve(function.Arity());
+    // The function has returned. Tail calls it made come back here, to run
+    // in its place.
+    if (step.stage == argc + 2) {
+        Value result = interp->PopReturn();
 
-    for (const auto& argExpr : call.args) {
-        argVals.push_back(env.ExtractFromLV(::Evaluate(*argExpr, interp)));
+        if (auto tailCall = interp->TakeTailCall())
+            return Call(tailCall->function, tailCall->args, tailCall->line, interp);
+
+        return interp->Finish(std::move(result));
     }
 
-    // Push a new execution context with the statements of this function
-    auto& ctx = interp->PushContext(ContextType::Function, function.statements);
+    // Evaluate the function we're actually calling, then the arguments from
+    // left to right
+    if (step.stage == 0 && not interp->Then(call.function))
+        return;
 
-    // Populate the parameters with values
-    for (std::size_t i = 0; i < function.Arity(); i++) {
-        ctx.environment.CreateOrAssignVar(function.params[i], argVals[i], function.line);
+    for (std::uint32_t stage = std::max(step.stage, 1u); stage <= argc; stage++) {
+        ExtractOperand(interp);
+
+        if (stage == 1)
+            CheckCallee(interp->Operand(), call, step.expr, interp);
+
+        if (not interp->Then(interp->GetProgram().Get(call.args)[stage - 1]))
+            return;
     }
 
-    // Execute the body of the function
-    interp->RunInterface();
+    ExtractOperand(interp);
+
+    if (argc == 0 && step.stage <= 1)
+        CheckCallee(interp->Operand(), call, step.expr, interp);
 
-    return interp->PopReturn();
+    const auto values = interp->TopOperands(argc + 1);
+    const Function function = values[0].GetAs<Function>();
+    const int line = interp->GetProgram().GetLine(step.expr);
+
+    // A call in return position can replace the returning function
+    if (step.tail && interp->CanReplaceFunction(interp->GetProgram().Get(function.params))) {
+        interp->SetTailCall({ .function = function, .args = { values.begin() + 1, values.end() }, .line = line });
+        interp->DropOperands(argc + 1);
+        return interp->Finish({});
+    }
+
+    interp->Advance();
+    Call(function, values.subspan(1), line, interp);
+    interp->DropOperands(argc + 1);
 }
 
-Value AstMethods::Evaluate(const Expr& expr, Interpreter& interpreter) {
-    return ::Evaluate(expr, &interpreter);
+bool AstMethods::EvaluateInPlace(ExprId expr, Interpreter& interpreter) {
+    const Program& program = interpreter.GetProgram();
+    const auto& env = interpreter.GetCurEnvironment();
+
+    const auto literal = [&](ExprId operand) -> const Value& {
+        return env.ExtractFromLV(program.literalExprs[operand.Index()].value);
+    };
+
+    switch (expr.GetKind()) {
+        case ExprKind::Literal:
+            interpreter.PushOperand(program.literalExprs[expr.Index()].value);
+            return true;
+        case ExprKind::Binary: {
+            const BinaryExpr& binary = program.binaryExprs[expr.Index()];
+
+            if (binary.left.GetKind() != ExprKind::Literal || binary.right.GetKind() != ExprKind::Literal)
+                return false;
+
+            const Value& left = literal(binary.left);
+            const Value& right = literal(binary.right);
+
+            interpreter.PushOperand(AtLineOf(expr, &interpreter, [&]() { return ApplyBinary(left, right, binary.op); }));
+            return true;
+        }
+        case ExprKind::Unary: {
+            const UnaryExpr& unary = program.unaryExprs[expr.Index()];
+
+            if (unary.operand.GetKind() != ExprKind::Literal)
+                return false;
+
+            const Value& operand = literal(unary.operand);
+
+            interpreter.PushOperand(AtLineOf(expr, &interpreter, [&]() { return ApplyUnary(operand, unary.op); }));
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+void AstMethods::Evaluate(const Step& step, Interpreter& interpreter) {
+    using enum ExprKind;
+
+    // Nodes are passed by value, since their pools may grow if a call parses
+    // the body of a deferred function while the node is evaluated. Literals
+    // have no children, so they can be used in place.
+    const Program& program = interpreter.GetProgram();
+    const std::uint32_t index = step.expr.Index();
+
+    switch (step.expr.GetKind()) {
+        case Binary:     return ::Evaluate(program.binaryExprs[index], step, &interpreter);
+        case Unary:      return ::Evaluate(program.unaryExprs[index], step, &interpreter);
+        case Grouping:   return ::Evaluate(program.groupingExprs[index], step, &interpreter);
+        case Literal:    return ::Evaluate(program.literalExprs[index], step, &interpreter);
+        case Assignment: return ::Evaluate(program.assignmentExprs[index], step, &interpreter);
+        case Call:       return ::Evaluate(program.callExprs[index], step, &interpreter);
+    }
+
+    throw std::runtime_error("Invalid expression kind");
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include <format>
+#include <stdexcept>
 #include <string>
 
 #include "core/AstMethods/Print.hpp"
@@ -6,47 +7,48 @@
 using namespace dxsh;
 using namespace core;
 
-declare_method(std::string, PrintRPN, (virtual_<const Expr&>));
-declare_method(std::string, PrintInfix, (virtual_<const Expr&>));
-
-
-define_method(std::string, PrintRPN, (const BinaryExpr& expr)) {
-    return std::format("{} {} {}", PrintRPN(*expr.left), PrintRPN(*expr.right), expr.op.GetRepresentation());
-}
-
-define_method(std::string, PrintRPN, (const UnaryExpr& expr)) {
-    return std::format("{} {}", PrintRPN(*expr.operand), expr.op.GetRepresentation());
-}
-
-define_method(std::string, PrintRPN, (const GroupingExpr& expr)) {
-    return PrintRPN(*expr.expr);
-}
-
-define_method(std::string, PrintRPN, (const LiteralExpr& expr)) {
-    return expr.ToString();
-}
-
-std::string AstMethods::PrintRPN(const Expr& expr) {
-    return ::PrintRPN(expr);
-}
-
-
-define_method(std::string, PrintInfix, (const BinaryExpr& expr)) {
-    return std::format("({} {} {})", PrintInfix(*expr.left), expr.op.GetRepresentation(), PrintInfix(*expr.right));
-}
-
-define_method(std::string, PrintInfix, (const UnaryExpr& expr)) {
-    return std::format("({}{})", expr.op.GetRepresentation(), PrintInfix(*expr.operand));
-}
-
-define_method(std::string, PrintInfix, (const GroupingExpr& expr)) {
-    return std::format("(group {})", PrintInfix(*expr.expr));
-}
-
-define_method(std::string, PrintInfix, (const LiteralExpr& expr)) {
-    return expr.ToString();
-}
-
-std::string AstMethods::PrintInfix(const Expr& expr) {
-    return ::PrintInfix(expr);
+std::string AstMethods::PrintRPN(const Program& program, ExprId expr) {
+    using enum ExprKind;
+
+    const std::uint32_t index = expr.Index();
+
+    switch (expr.GetKind()) {
+        case Binary: {
+            const BinaryExpr& binary = program.binaryExprs[index];
+            return std::format("{} {} {}", PrintRPN(program, binary.left), PrintRPN(program, binary.right), GetTokenRepresentation(binary.op));
+        }
+        case Unary: {
+            const UnaryExpr& unary = program.unaryExprs[index];
+            return std::format("{} {}", PrintRPN(program, unary.operand), GetTokenRepresentation(unary.op));
+        }
+        case Grouping:
+            return PrintRPN(program, program.groupingExprs[index].expr);
+        case Literal:
+            return program.literalExprs[index].ToString();
+        default:
+            throw std::runtime_error("PrintRPN: unsupported expression");
+    }
+}
+
+std::string AstMethods::PrintInfix(const Program& program, ExprId expr) {
+    using enum ExprKind;
+
+    const std::uint32_t index = expr.Index();
+
+    switch (expr.GetKind()) {
+        case Binary: {
+            const BinaryExpr& binary = program.binaryExprs[index];
+            return std::format("({} {} {})", PrintInfix(program, binary.left), GetTokenRepresentation(binary.op), PrintInfix(program, binary.right));
+        }
+        case Unary: {
+            const UnaryExpr& unary = program.unaryExprs[index];
+            return std::format("({}{})", GetTokenRepresentation(unary.op), PrintInfix(program, unary.operand));
+        }
+        case Grouping:
+            return std::format("(group {})", PrintInfix(program, program.groupingExprs[index].expr));
+        case Literal:
+            return program.literalExprs[index].ToString();
+        default:
+            throw std::runtime_error("PrintInfix: unsupported expression");
+    }
 }
\ No newline at end of file
@@ -0,0 +1,311 @@
+#include <algorithm>
+#include <stdexcept>
+#include "core/Bytecode.hpp"
+
+using namespace dxsh;
+using namespace core;
+
+namespace {
+    class Compiler {
+        const Program& program;
+        const SymbolTable& symbols;
+        Chunk& chunk;
+
+        // Slots of an enclosing scope, within the frame of the chunk
+        struct ScopeLayout {
+            std::uint32_t base;
+            std::uint32_t size;
+        };
+
+        // Enclosing scopes, innermost last, mirroring the resolver's. Empty in
+        // the global scope.
+        std::vector<ScopeLayout> scopes;
+
+        // Only function bodies make tail calls, returning from the top level fails
+        bool inFunction{};
+
+        public:
+        Compiler(const Program& program, const SymbolTable& symbols, Chunk& chunk)
+            : program(program), symbols(symbols), chunk(chunk)
+        { }
+
+        void CompileStatements(StatementList statements) {
+            for (std::uint32_t i = 0; i < statements.count; i++) {
+                CompileStatement(program.stmtLists[statements.first + i]);
+            }
+        }
+
+        void CompileFunction(std::uint32_t func);
+
+        std::uint32_t Emit(OpCode op, std::uint32_t arg, int line) {
+            if (arg > MaxInstructionArg)
+                throw std::length_error("Too many constants or instructions in function");
+
+            chunk.code.push_back(MakeInstruction(op, arg));
+            chunk.lines.push_back(line);
+            return static_cast<std::uint32_t>(chunk.code.size() - 1);
+        }
+
+        private:
+        void CompileStatement(StmtId stmt);
+        // A call in tail position may run in place of the function
+        void CompileExpr(ExprId expr, bool isTail = false);
+
+        void PushScope(std::uint32_t size) {
+            const std::uint32_t base = scopes.empty() ? 0 : scopes.back().base + scopes.back().size;
+            scopes.push_back({ base, size });
+            chunk.slotCount = std::max(chunk.slotCount, base + size);
+        }
+
+        // Jumps to the next instruction emitted
+        void PatchJump(std::uint32_t jump) {
+            const auto target = static_cast<std::uint32_t>(chunk.code.size());
+
+            if (target > MaxInstructionArg)
+                throw std::length_error("Too many constants or instructions in function");
+
+            chunk.code[jump] = MakeInstruction(GetOpCode(chunk.code[jump]), target);
+        }
+
+        std::uint32_t AddConstant(Value value) {
+            chunk.constants.push_back(std::move(value));
+            return static_cast<std::uint32_t>(chunk.constants.size() - 1);
+        }
+
+        std::uint32_t AddVar(Binding binding, Symbol symbol, int line) {
+            VarRef var{
+                  .kind = binding.kind
+                , .symbol = symbol
+                , .lineOfRef = line
+                , .name = symbols.GetName(symbol)
+            };
+
+            if (binding.kind == Binding::Kind::Local) {
+                const ScopeLayout& scope = scopes[scopes.size() - 1 - binding.hops];
+                var.slot = scope.base + binding.slot;
+                var.scopeBase = scope.base;
+            }
+
+            chunk.vars.push_back(var);
+            return static_cast<std::uint32_t>(chunk.vars.size() - 1);
+        }
+
+        void EmitDeclare(Binding binding, Symbol symbol, int line) {
+            // Declarations in the global scope aren't always resolved, as in the REPL
+            if (binding.kind == Binding::Kind::Local && binding.hops == 0)
+                Emit(OpCode::DeclareLocal, AddVar(binding, symbol, line), line);
+            else
+                Emit(OpCode::DeclareGlobal, AddVar({ .kind = Binding::Kind::Global }, symbol, line), line);
+        }
+
+        // Identifiers, possibly in parentheses, evaluate to an lvalue, which is
+        // only looked up when something uses its value
+        const Lvalue* AsLvalue(ExprId expr) const {
+            while (expr.GetKind() == ExprKind::Grouping) {
+                expr = program.groupingExprs[expr.Index()].expr;
+            }
+
+            if (expr.GetKind() != ExprKind::Literal)
+                return nullptr;
+
+            const Value& value = program.literalExprs[expr.Index()].value;
+            return value.GetType() == ValueType::Lvalue ? &value.GetAs<Lvalue>() : nullptr;
+        }
+    };
+}
+
+void Compiler::CompileFunction(std::uint32_t func) {
+    const FuncStatement& node = program.funcStmts[func];
+
+    inFunction = true;
+    PushScope(node.slots.count);
+
+    CompileStatements(node.statements);
+
+    // Parsed bodies end in a return, this only guards against running off the end
+    const int line = program.GetLine(StmtId(StmtKind::Func, func));
+    Emit(OpCode::Const, AddConstant({}), line);
+    Emit(OpCode::Return, 0, line);
+}
+
+void Compiler::CompileStatement(StmtId stmt) {
+    using enum StmtKind;
+
+    const std::uint32_t index = stmt.Index();
+    const int line = program.GetLine(stmt);
+
+    switch (stmt.GetKind()) {
+        case Expr: {
+            // A lone identifier is never looked up, so it can't fail
+            const ExprId expr = program.exprStmts[index].expr;
+
+            if (AsLvalue(expr) == nullptr) {
+                CompileExpr(expr);
+                Emit(OpCode::Pop, 0, line);
+            }
+
+            break;
+        }
+        case Print:
+            CompileExpr(program.printStmts[index].expr);
+            Emit(OpCode::Print, 0, line);
+            break;
+        case VarDecl: {
+            const VarDeclStatement& node = program.varDeclStmts[index];
+            CompileExpr(node.value);
+            EmitDeclare(node.binding, node.symbol, line);
+            break;
+        }
+        case Block: {
+            const BlockStatement& node = program.blockStmts[index];
+            PushScope(node.slots.count);
+            CompileStatements(node.statements);
+
+            // Leaving the scope drops its variables, for anything that looks
+            // them up by name later
+            if (const ScopeLayout scope = scopes.back(); scope.size != 0) {
+                Emit(OpCode::ClearLocals, scope.size, line);
+                chunk.code.push_back(scope.base);
+                chunk.lines.push_back(line);
+            }
+
+            scopes.pop_back();
+            break;
+        }
+        case If: {
+            const IfStatement node = program.ifStmts[index];
+            CompileExpr(node.condition);
+
+            const std::uint32_t skipYes = Emit(OpCode::JumpIfFalse, 0, line);
+            CompileStatement(node.yesBranch);
+
+            if (node.noBranch) {
+                const std::uint32_t skipNo = Emit(OpCode::Jump, 0, line);
+                PatchJump(skipYes);
+                CompileStatement(node.noBranch);
+                PatchJump(skipNo);
+            } else {
+                PatchJump(skipYes);
+            }
+
+            break;
+        }
+        case Func: {
+            // Function values are the same every time the statement runs
+            const FuncStatement& node = program.funcStmts[index];
+
+            Emit(OpCode::Const, AddConstant(Function{
+                  .line = line
+                , .name = symbols.GetName(node.name)
+                , .params = node.params
+                , .definition = index
+            }), line);
+
+            EmitDeclare(node.binding, node.name, line);
+            break;
+        }
+        case Return:
+            if (const ExprId expr = program.returnStmts[index].expr)
+                CompileExpr(expr, inFunction);
+            else
+                Emit(OpCode::Const, AddConstant({}), line);
+
+            Emit(OpCode::Return, 0, line);
+            break;
+    }
+}
+
+void Compiler::CompileExpr(ExprId expr, bool isTail) {
+    using enum ExprKind;
+
+    const std::uint32_t index = expr.Index();
+    const int line = program.GetLine(expr);
+
+    switch (expr.GetKind()) {
+        case Binary: {
+            const BinaryExpr& node = program.binaryExprs[index];
+            CompileExpr(node.left);
+            CompileExpr(node.right);
+            Emit(OpCode::Binary, static_cast<std::uint32_t>(node.op), line);
+            break;
+        }
+        case Unary: {
+            const UnaryExpr& node = program.unaryExprs[index];
+            CompileExpr(node.operand);
+            Emit(OpCode::Unary, static_cast<std::uint32_t>(node.op), line);
+            break;
+        }
+        case Grouping:
+            CompileExpr(program.groupingExprs[index].expr, isTail);
+            break;
+        case Literal: {
+            const Value& value = program.literalExprs[index].value;
+
+            if (value.GetType() != ValueType::Lvalue) {
+                Emit(OpCode::Const, AddConstant(value), line);
+                break;
+            }
+
+            const Lvalue& lvalue = value.GetAs<Lvalue>();
+            const std::uint32_t var = AddVar(lvalue.binding, lvalue.symbol, lvalue.lineOfRef);
+
+            switch (lvalue.binding.kind) {
+                case Binding::Kind::Local:   Emit(OpCode::LoadLocal, var, line); break;
+                case Binding::Kind::Global:  Emit(OpCode::LoadGlobal, var, line); break;
+                case Binding::Kind::Dynamic: Emit(OpCode::LoadDynamic, var, line); break;
+            }
+
+            break;
+        }
+        case Assignment: {
+            const AssignmentExpr& node = program.assignmentExprs[index];
+
+            // Anything but an identifier still runs before failing
+            const Lvalue* target = AsLvalue(node.target);
+
+            if (target == nullptr) {
+                CompileExpr(node.target);
+                Emit(OpCode::AssignError, 0, line);
+                break;
+            }
+
+            // The variable has to exist before the value is evaluated
+            const std::uint32_t var = AddVar(target->binding, target->symbol, target->lineOfRef);
+            Emit(OpCode::CheckVar, var, line);
+            CompileExpr(node.value);
+            Emit(OpCode::Store, var, line);
+            break;
+        }
+        case Call: {
+            const CallExpr& node = program.callExprs[index];
+            CompileExpr(node.function);
+
+            // Arity is checked before any argument is evaluated
+            Emit(OpCode::CheckCall, node.args.count, line);
+
+            for (std::uint32_t i = 0; i < node.args.count; i++) {
+                CompileExpr(program.exprLists[node.args.first + i]);
+            }
+
+            Emit(isTail ? OpCode::TailCall : OpCode::Call, node.args.count, line);
+            break;
+        }
+    }
+}
+
+Chunk core::CompileScript(const Program& program, StatementList statements, const SymbolTable& symbols) {
+    Chunk chunk;
+    Compiler compiler(program, symbols, chunk);
+
+    compiler.CompileStatements(statements);
+    compiler.Emit(OpCode::Halt, 0, 0);
+
+    return chunk;
+}
+
+Chunk core::CompileFunction(const Program& program, std::uint32_t func, const SymbolTable& symbols) {
+    Chunk chunk;
+    Compiler(program, symbols, chunk).CompileFunction(func);
+
+    return chunk;
+}
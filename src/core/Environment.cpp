@@ -1,5 +1,8 @@
+#include <algorithm>
 #include <format>
+#include <stdexcept>
 #include "core/Environment.hpp"
+#include "core/Program.hpp"
 #include "core/Value.hpp"
 
 using namespace dxsh;
@@ -10,56 +13,124 @@ void VarDecl::Set(const Value& value, int line) {
     lineOfLastAssign = line;
 }
 
-const VarDecl* Environment::GetVar(std::string_view name) const {
-    return const_cast<Environment*>(this)->GetVar(name);
+void Environment::ResetAsChildOf(Environment& parent, std::size_t slotCount) {
+    this->parent = &parent;
+    this->globals = &parent.GetGlobals();
+    this->slotCount = slotCount;
+
+    // Symbols are filled in by declarations, which are all that lookups check
+    slots.clear();
+}
+
+const VarDecl* Environment::GetVar(const Lvalue& lvalue) const {
+    return const_cast<Environment*>(this)->GetVar(lvalue);
+}
+
+VarDecl* Environment::GetVar(const Lvalue& lvalue) {
+    using enum Binding::Kind;
+
+    const Binding& binding = lvalue.binding;
+
+    switch (binding.kind) {
+        case Local: {
+            Environment* env = this;
+
+            for (std::uint16_t i = 0; i < binding.hops; i++) {
+                env = env->parent;
+            }
+
+            if (binding.slot < env->slots.size() && env->slots[binding.slot].declared)
+                return &env->slots[binding.slot];
+
+            // A declaration that didn't run, such as in an if without braces,
+            // leaves whatever the name meant further out visible
+            return env->parent != nullptr ? env->parent->FindVar(lvalue.symbol) : nullptr;
+        }
+        case Global:
+            // Only names outside every function are bound here, where no caller
+            // can declare them
+            return GetGlobals().FindGlobal(lvalue.symbol);
+        case Dynamic:
+            if (not GetGlobals().program->MayBeLocal(lvalue.symbol))
+                return GetGlobals().FindGlobal(lvalue.symbol);
+
+            return FindVar(lvalue.symbol);
+    }
+
+    return nullptr;
 }
 
-VarDecl* Environment::GetVar(std::string_view name) {
-    auto it = variables.find(std::string(name));
+VarDecl* Environment::FindVar(Symbol symbol) {
+    for (Environment* env = this; env != nullptr; env = env->parent) {
+        if (env->IsGlobal())
+            return env->FindGlobal(symbol);
 
-    if (it == variables.end()) {
-        if (parent != nullptr) {
-            return parent->GetVar(name);
-        } else {
-            return nullptr;
+        // A name is only declared twice in one scope as a repeated parameter,
+        // where the later one wins, as for resolved names
+        for (std::size_t i = env->slots.size(); i-- > 0;) {
+            if (env->slots[i].symbol == symbol && env->slots[i].declared)
+                return &env->slots[i];
         }
     }
 
-    return &it->second;
+    return nullptr;
 }
 
-Environment Environment::MakeChild() {
-    Environment env;
-    env.parent = this;
-    return env;
+VarDecl* Environment::FindGlobal(Symbol symbol) {
+    if (symbol >= slots.size() || not slots[symbol].declared)
+        return nullptr;
+
+    return &slots[symbol];
 }
 
+void Environment::CreateOrAssignVar(const Binding& binding, Symbol symbol, const Value& value, int line) {
+    VarDecl* var = nullptr;
 
-void Environment::CreateOrAssignVar(std::string_view name, const Value& value, int line) {
-    auto it = variables.find(std::string(name));
+    if (binding.kind == Binding::Kind::Local && binding.hops == 0) {
+        if (slots.empty())
+            slots.resize(slotCount);
 
-    if (it != variables.end()) {
-        it->second.value = value;
-        it->second.lineOfLastAssign = line;
+        var = &slots[binding.slot];
+    } else if (binding.kind == Binding::Kind::Global || IsGlobal()) {
+        Environment& global = GetGlobals();
+
+        if (symbol >= global.slots.size())
+            global.slots.resize(symbol + 1);
+
+        var = &global.slots[symbol];
     } else {
-        VarDecl var{};
-        var.name = std::string(name);
-        var.value = value;
-        var.lineOfDecl = line;
+        throw std::logic_error("Declaration was not resolved to this scope");
+    }
 
-        variables.emplace(var.name, var);
+    if (var->declared) {
+        var->value = value;
+        var->lineOfLastAssign = line;
+    } else {
+        var->symbol = symbol;
+        var->value = value;
+        var->lineOfDecl = line;
+        var->declared = true;
     }
 }
 
+bool Environment::DeclaresOnly(std::span<const Symbol> symbols) const {
+    for (const VarDecl& var : slots) {
+        if (var.declared && std::ranges::find(symbols, var.symbol) == symbols.end())
+            return false;
+    }
+
+    return true;
+}
+
 const Value& Environment::ExtractFromLV(const Value& v) const {
     if (v.GetType() != ValueType::Lvalue)
         return v;
 
-    Lvalue lv = v.GetAs<Lvalue>();
-    const VarDecl* var = GetVar(lv.name);
+    const Lvalue& lv = v.GetAs<Lvalue>();
+    const VarDecl* var = GetVar(lv);
 
     if (var == nullptr)
-        throw UndefinedVariableError(lv.lineOfRef, v.GetAs<Lvalue>().name);
+        throw UndefinedVariableError(lv.lineOfRef, lv.name);
 
     return var->GetValue();
 }
@@ -69,4 +140,4 @@ UndefinedVariableError::UndefinedVariableError(int line, std::string_view name)
           .line = line
         , .message = std::format("Use of undefined variable '{}'", name)
     }
-{ }
\ No newline at end of file
+{ }
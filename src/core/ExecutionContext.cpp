@@ -6,24 +6,30 @@ using namespace dxsh;
 using namespace core;
 
 ExecutionStatus ExecutionContext::ExecuteOne(Interpreter& interpreter) {
-    // Close out this execution block once we reach the end
-    if (curPos >= statements.size())
-        return ExecutionStatus::CLOSE;
+    // The next statement starts once the last one has finished, along with
+    // the calls and blocks it ran
+    if (interpreter.StepCount() == stepBase) {
+        // Close out this execution block once we reach the end
+        if (curPos >= statements.size())
+            return ExecutionStatus::CLOSE;
+
+        interpreter.Start(interpreter.GetProgram().Get(statements)[curPos++]);
+    }
 
-    auto effect = EvaluateStatement(*statements[curPos], interpreter);
+    auto effect = interpreter.RunSteps(stepBase);
 
     if (not interpreter.errors.empty())
         return ExecutionStatus::ERROR;
 
-    curPos++;
-
     // Triggered by break
     if (effect == StatementEffect::CloseContext)
         return ExecutionStatus::CLOSE;
     // Triggered by return
     else if (effect == StatementEffect::ExitFunction)
         return ExecutionStatus::EXIT_FUNCTION;
+    // Triggered by calls and blocks, the statement goes on once they're done
+    else if (effect == StatementEffect::EnterContext)
+        return ExecutionStatus::ENTER_CONTEXT;
 
-    // If we reach the end of this context, trigger a pop of the callstack
     return ExecutionStatus::SUCCESS;
 }
\ No newline at end of file
@@ -1,14 +1,26 @@
 #include "core/Interpreter.hpp"
 #include "core/ExecutionContext.hpp"
 #include "core/Statement.hpp"
+#include "core/AstMethods/Evaluate.hpp"
 
 using namespace std::string_literals;
 using namespace dxsh;
 using namespace core;
 
-void Interpreter::LoadProgram(std::span<const std::unique_ptr<Statement>> statements) {
+void Interpreter::LoadProgram(const Program& program, StatementList statements) {
+    // Unwind anything left over from a previous program (such as after an error),
+    // which hands its top-level variables back to globals
+    while (depth != 0) {
+        PopContext();
+    }
+
+    steps.clear();
+    operands.clear();
+    tailCall.reset();
+
     // Setup the global execution context
-    callstack = {};
+    this->program = &program;
+    globals.SetProgram(program);
     PushContext(ContextType::Script, statements);
 }
 
@@ -16,71 +28,208 @@ void Interpreter::LoadInterface(std::function<void ()> interface) {
     interpreterInterface = std::move(interface);
 }
 
+void Interpreter::LoadFunctionParser(std::function<StatementList(std::uint32_t)> parser) {
+    functionParser = std::move(parser);
+}
+
 void Interpreter::RunInterface() {
     interpreterInterface();
 }
 
+void Interpreter::SetYieldBudget(YieldBudget budget) {
+    yieldCounter.SetBudget(budget);
+}
+
+bool Interpreter::CountStatement() {
+    statementsRun++;
+
+    // Output of calls made by the statement was counted in their own contexts
+    return std::exchange(printed, false) ? yieldCounter.TickOutput() : yieldCounter.Tick();
+}
+
 std::generator<RuntimeStatus> Interpreter::ExecuteTopContext() {
     using enum ExecutionStatus;
 
-    while (!isExitingFunction) {
-        auto status = callstack.top().ExecuteOne(*this);
+    // Calls and blocks push their contexts onto the callstack and carry on in
+    // this same loop, so the native stack stays flat however deep they go
+    while (true) {
+        auto status = Top().ExecuteOne(*this);
 
         switch (status) {
             case SUCCESS:
-                co_yield RuntimeStatus::RanStatement;
+                if (CountStatement()) {
+                    co_yield RuntimeStatus::RanStatement;
+                    yieldCounter.Reset();
+                }
+
+                break;
+            case ENTER_CONTEXT:
                 break;
             case CLOSE:
                 PopContext();
+
+                // The step that pushed the context picks up from here
+                if (depth != 0)
+                    break;
+
                 co_yield RuntimeStatus::ClosedContext;
                 co_return;
-            case EXIT_FUNCTION: {
-                // Return statement was run, we will reenter this coroutine
-                // and begin the exit function process
-                co_yield RuntimeStatus::RanStatement;
-                isExitingFunction = true;
-                break;
-            }
+            case EXIT_FUNCTION:
+                if (CountStatement()) {
+                    co_yield RuntimeStatus::RanStatement;
+                    yieldCounter.Reset();
+                }
+
+                if (ReturnFromFunction())
+                    break;
+
+                errors.push_back(Error{
+                      .line = 0
+                    , .message = "Returning from top-level not implemented"});
+
+                co_yield RuntimeStatus::Error;
+                co_return;
             case ERROR:
                 co_yield RuntimeStatus::Error;
                 co_return;
         }
     }
-    
-    if (callstack.top().type == ContextType::Script) {
-        errors.push_back(Error{ 
-                .line = 0
-            , .message = "Returning from top-level not implemented"});
-
-        co_yield RuntimeStatus::Error;
-        co_return;
-    }
+}
 
-    // Continue to exit the current function until we reach the callstack of said function
-    isExitingFunction = callstack.top().type != ContextType::Function;
+bool Interpreter::ReturnFromFunction() {
+    while (Top().type != ContextType::Function) {
+        if (Top().type == ContextType::Script)
+            return false;
+
+        PopContext();
+    }
 
+    // Blocks the return left are dropped, down to the call waiting on it
+    steps.resize(Top().StepBase());
     PopContext();
-    co_yield RuntimeStatus::ClosedContext;
+
+    return true;
 }
 
-Environment& Interpreter::GetCurEnvironment() {
-    return callstack.top().environment;
+StatementEffect Interpreter::RunSteps(std::size_t base) {
+    const std::size_t running = depth;
+
+    try {
+        while (steps.size() > base) {
+            const Step step = steps.back();
+
+            if (step.expr) {
+                AstMethods::Evaluate(step, *this);
+            } else if (auto effect = EvaluateStatement(step, *this); effect != StatementEffect::None) {
+                return effect;
+            }
+
+            if (depth != running)
+                return StatementEffect::EnterContext;
+        }
+    } catch (const Error& e) {
+        errors.push_back(e);
+    }
+
+    return StatementEffect::None;
+}
+
+bool Interpreter::Then(ExprId child, bool tail) {
+    Advance();
+
+    if (AstMethods::EvaluateInPlace(child, *this))
+        return true;
+
+    steps.push_back({ .expr = child, .tail = tail });
+    return false;
 }
 
-ExecutionContext& Interpreter::PushContext(ContextType type, std::span<const std::unique_ptr<Statement>> statements) {
-    ExecutionContext newFrame(callstack.size(), type, statements);
+void Interpreter::Replace(ExprId child) {
+    steps.pop_back();
+
+    if (not AstMethods::EvaluateInPlace(child, *this))
+        steps.push_back({ .expr = child });
+}
+
+void Interpreter::Replace(StmtId child) {
+    steps.back() = { .stmt = child };
+}
+
+void Interpreter::Finish(Value value) {
+    steps.pop_back();
+    operands.push_back(std::move(value));
+}
+
+Value Interpreter::PopOperand() {
+    Value v = std::move(operands.back());
+    operands.pop_back();
+
+    return v;
+}
+
+StatementList Interpreter::GetFunctionBody(const Function& function) {
+    const FuncStatement& definition = program->funcStmts[function.definition];
+
+    if (definition.IsParsed())
+        return definition.statements;
 
-    if (callstack.size() != 0) {
-        Environment& curEnv = GetCurEnvironment();
-        newFrame.environment = curEnv.MakeChild();
+    if (not functionParser)
+        throw std::runtime_error("Deferred function body with no function parser loaded");
+
+    return functionParser(function.definition);
+}
+
+bool Interpreter::CanReplaceFunction(std::span<const Symbol> params) const {
+    for (std::size_t i = depth; i-- > 0;) {
+        const ExecutionContext& context = callstack[i];
+
+        if (context.type == ContextType::Script || not context.environment.DeclaresOnly(params))
+            return false;
+
+        if (context.type == ContextType::Function)
+            return true;
     }
 
-    callstack.push(newFrame);
-    return callstack.top();
+    return false;
+}
+
+Environment& Interpreter::GetCurEnvironment() {
+    return Top().environment;
+}
+
+ExecutionContext& Interpreter::PushContext(ContextType type, StatementList statements, std::size_t slots, int line) {
+    const std::size_t size = (depth + 1) * sizeof(ExecutionContext)
+        + (slotsInUse + slots) * sizeof(VarDecl)
+        + steps.size() * sizeof(Step)
+        + operands.size() * sizeof(Value);
+
+    if (depth != 0 && size > stackLimit)
+        throw Error{ .line = line, .message = "Stack overflow" };
+
+    if (depth == callstack.size())
+        callstack.emplace_back();
+
+    ExecutionContext& context = callstack[depth];
+    context.Reset(depth, type, statements, steps.size());
+
+    if (depth != 0)
+        context.environment.ResetAsChildOf(GetCurEnvironment(), slots);
+    else
+        context.environment = std::move(globals);
+
+    slotsInUse += slots;
+    depth++;
+    return context;
 }
 
 void Interpreter::PopContext() {
-    callstack.pop();
+    // Leaving the script context, keep its variables for the next program
+    if (depth == 1)
+        globals = std::move(Top().environment);
+    else
+        slotsInUse -= Top().environment.SlotCount();
+
+    depth--;
 }
 
 void Interpreter::PushReturn(Value value) {
@@ -109,6 +258,7 @@ std::string Interpreter::TakeInput() {
 
 void Interpreter::GiveOutput(std::string_view output) {
     this->output << output;
+    printed = true;
 }
 
 std::string Interpreter::TakeOutput() {
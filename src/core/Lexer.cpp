@@ -1,44 +1,75 @@
-#include <cctype>
+#include <limits>
 #include <stdexcept>
 #include <type_traits>
 
 #include "core/Lexer.hpp"
+#include "core/Scanner.hpp"
 #include "core/Tokens.hpp"
 
 using namespace dxsh;
 using namespace core;
+using Scanner::IsAlpha;
+using Scanner::IsDigit;
 
-static bool IsAlpha(char c) {
-    return std::isalpha(c) || c == '_';
-}
-
-static bool IsAlphanumeric(char c) {
-    return IsAlpha(c) || std::isdigit(c);
-}
-
-std::vector<Token> Lexer::Parse(std::string_view source) {
+TokenBuffer Lexer::Parse(std::string_view source, int firstLine) {
     this->source = source;
 
     curPos = 0;
-    curLine = 1;
+    curLine = firstLine;
+    streaming = false;
 
-    tokens.clear();
+    tokens = TokenBuffer(source);
+
+    // Token offsets and lengths are stored in 32 bits
+    if (source.size() > std::numeric_limits<std::uint32_t>::max()) [[unlikely]] {
+        errors->push_back({0, "Source is too large (over 4 GiB)"});
+        return std::move(tokens);
+    }
 
     while (not IsAtEnd()) {
         Scan();
     }
 
+    tokenStart = curPos;
+    tokenLine = curLine;
     AddToken(TokenType::Eof);
 
     return std::move(tokens);
 }
 
-void Lexer::Scan() {
-    char c = Advance();
+void Lexer::Start(std::string_view source, int firstLine) {
+    this->source = source;
+
+    curPos = 0;
+    curLine = firstLine;
+    streaming = true;
+
+    tokens = {};
+    streamed.reset();
+}
+
+Token Lexer::Next() {
+    while (not IsAtEnd()) {
+        Scan();
 
-    Token token {
-        .line = curLine
+        if (streamed.has_value()) {
+            Token token = *streamed;
+            streamed.reset();
+            return token;
+        }
+    }
+
+    return Token{
+          .type = TokenType::Eof
+        , .line = curLine
+        , .lexeme = source.substr(curPos, 0)
     };
+}
+
+void Lexer::Scan() {
+    tokenStart = curPos;
+    tokenLine = curLine;
+    char c = Advance();
 
     switch (c) {
         // Single character only tokens
@@ -76,7 +107,7 @@ void Lexer::Scan() {
             else AddToken(TokenType::Star);
             break;
         case '.':
-            if (std::isdigit(Peek())) LexNumber(LeadingDecimal::Yes);
+            if (IsDigit(Peek())) LexNumber(LeadingDecimal::Yes);
             else AddToken(TokenType::Dot);
             break;
         case '/': 
@@ -87,19 +118,19 @@ void Lexer::Scan() {
         // Literals
         case '"': LexString(); break;
 
-        // Whitespace
+        // Whitespace is skipped a whole run at a time
         case '\n':
-            curLine++;
         case '\t':
         case '\r':
         case ' ':
-            break; // Ignore all whitespace
+            SkipWhitespace();
+            break;
 
         default: 
             if (IsAlpha(c)) {
                 LexIdentifier();
                 break;
-            } else if (std::isdigit(c)) {
+            } else if (IsDigit(c)) {
                 LexNumber(LeadingDecimal::No);
                 break;
             }
@@ -111,60 +142,46 @@ void Lexer::Scan() {
 }
 
 void Lexer::LexString() {
-    std::size_t start = curPos - 1;
     int startingLine = curLine;
 
-    while (Peek() != '"') {
-        if (IsAtEnd()) [[unlikely]] {
-            errors->push_back(Error{
-                  .line = curLine
-                , .message = std::format("Unterminated string literal (starting at line {})", startingLine)
-            });
+    std::size_t closing = Scanner::FindQuote(source, curPos);
+    CountNewlines(curPos, closing);
 
-            return;
-        }
+    if (closing == source.size()) [[unlikely]] {
+        curPos = closing;
 
-        Advance();
-    }
+        errors->push_back(Error{
+              .line = curLine
+            , .message = std::format("Unterminated string literal (starting at line {})", startingLine)
+        });
 
-    Advance(); // The terminating "
-
-    std::string_view lexeme = std::string_view(source.begin() + start, source.begin() + curPos);
-    
-    if (lexeme.size() > 2) [[likely]] {
-        AddToken(
-              TokenType::String
-            , std::string(lexeme)
-            , std::string(lexeme.substr(1, lexeme.size() - 2))
-        );
-    } else {
-        AddToken(
-              TokenType::String
-            , std::string(lexeme)
-            , ""
-        );
+        return;
     }
+
+    curPos = closing + 1; // Past the terminating "
+
+    // No escapes, so the literal is the lexeme without its quotes
+    AddToken(TokenType::String, source.substr(tokenStart + 1, closing - tokenStart - 1));
 }
 
 void Lexer::LexIdentifier() {
-    std::size_t start = curPos - 1;
-
-    while (IsAlphanumeric(Peek())) {
-        Advance();
-    }
+    curPos = Scanner::SkipIdentifier(source, curPos);
 
-    std::string_view lexeme = source.substr(start, curPos - start);
-    auto type = GetPotentialKeywordTokenType(lexeme);
+    std::string_view lexeme = source.substr(tokenStart, curPos - tokenStart);
+    TokenType type = GetPotentialKeywordTokenType(lexeme);
 
-    AddToken(type, std::string(lexeme), std::monostate{});
+    if (type == TokenType::Identifier)
+        AddIdentifier(symbols->Intern(lexeme));
+    else
+        AddToken(type);
 }
 
 void Lexer::LexNumber(LeadingDecimal hasLeadingDecimal) {
-    std::size_t start = curPos - 1;
-    
+    std::size_t start = tokenStart;
+
     if (hasLeadingDecimal == LeadingDecimal::No) {
         // Grab all following digits
-        while (std::isdigit(Peek())) {
+        while (IsDigit(Peek())) {
             Advance();
         }
 
@@ -178,7 +195,7 @@ void Lexer::LexNumber(LeadingDecimal hasLeadingDecimal) {
     }
 
     // Consume all fractional parts and decimal points
-    while (std::isdigit(Peek()) || Peek() == '.') {
+    while (IsDigit(Peek()) || Peek() == '.') {
         Advance();
     }
 
@@ -238,7 +255,6 @@ void Lexer::ParseAndAddNumber(std::string_view str) {
 
     AddToken(
           literalName == "integer" ? TokenType::Integer : TokenType::Decimal
-        , std::string(str)
         , value
     );
 }
@@ -247,34 +263,84 @@ template void Lexer::ParseAndAddNumber<int>(std::string_view str);
 template void Lexer::ParseAndAddNumber<float>(std::string_view str);
 
 void Lexer::AddToken(TokenType type) {
-    tokens.push_back(Token{
-          .type = type
-        , .line = curLine
-    });
+    AddToken(type, std::monostate{});
 }
 
-void Lexer::AddToken(TokenType type, std::string lexeme, decltype(Token::literal) literal) {
-    tokens.push_back(Token{
-          .type = type
-        , .line = curLine
-        , .lexeme = std::move(lexeme)
-        , .literal = std::move(literal)
-    });
+void Lexer::AddToken(TokenType type, Token::Literal literal) {
+    if (streaming) {
+        streamed = Token{
+              .type = type
+            , .line = tokenLine
+            , .lexeme = source.substr(tokenStart, curPos - tokenStart)
+            , .literal = literal
+        };
+
+        return;
+    }
+
+    auto offset = static_cast<std::uint32_t>(tokenStart);
+    auto length = static_cast<std::uint32_t>(curPos - tokenStart);
+
+    if (std::holds_alternative<std::monostate>(literal))
+        tokens.Push(type, offset, length);
+    else
+        tokens.Push(type, offset, length, literal);
+}
+
+void Lexer::AddIdentifier(Symbol symbol) {
+    if (streaming) {
+        streamed = Token{
+              .type = TokenType::Identifier
+            , .line = tokenLine
+            , .lexeme = source.substr(tokenStart, curPos - tokenStart)
+            , .symbol = symbol
+        };
+
+        return;
+    }
+
+    tokens.PushIdentifier(
+          static_cast<std::uint32_t>(tokenStart)
+        , static_cast<std::uint32_t>(curPos - tokenStart)
+        , symbol
+    );
+}
+
+void Lexer::NewLine(std::size_t lineStart) {
+    curLine++;
+
+    // Streamed tokens carry their line directly
+    if (not streaming)
+        tokens.AddLineStart(static_cast<std::uint32_t>(lineStart));
+}
+
+void Lexer::CountNewlines(std::size_t from, std::size_t to) {
+    std::string_view region = source.substr(0, to);
+
+    for (std::size_t pos = Scanner::FindNewline(region, from); pos < to; pos = Scanner::FindNewline(region, pos + 1)) {
+        NewLine(pos + 1);
+    }
+}
+
+void Lexer::SkipWhitespace() {
+    std::size_t start = curPos - 1; // Scan already consumed the first character
+
+    curPos = Scanner::SkipWhitespace(source, curPos);
+    CountNewlines(start, curPos);
 }
 
 void Lexer::SkipToNewline() {
-    while (not IsAtEnd() and Peek() != '\n') {
-        Advance();
-    };
+    curPos = Scanner::FindNewline(source, curPos);
 }
 
+// Callers check IsAtEnd first
 char Lexer::Advance() {
-    return source.at(curPos++);
+    return source[curPos++];
 }
 
 char Lexer::Peek() const {
     if (IsAtEnd()) return '\0';
-    return source.at(curPos);
+    return source[curPos];
 }
 
 bool Lexer::MatchConsume(char c) {
@@ -0,0 +1,273 @@
+#include <cmath>
+#include <format>
+#include <optional>
+#include <stdexcept>
+#include <variant>
+#include "core/Error.hpp"
+#include "core/Operators.hpp"
+#include "magic_enum/magic_enum.hpp"
+
+using namespace dxsh;
+using namespace core;
+
+enum class UnaryConversionTarget { Numeric, Boolean };
+
+struct BinaryConversionResult {
+    Value left, right;
+};
+
+static std::optional<BinaryConversionResult> NumericConversion(const Value& left, const Value& right) {
+    using Res = BinaryConversionResult;
+    using enum ValueType;
+
+    ValueType typeL = left.GetType();
+    ValueType typeR = right.GetType();
+
+    // Only support arithmetic operations on int, float
+    if (not left.IsArithmetic() || not right.IsArithmetic())
+        return std::nullopt;
+
+    // No conversion necessary
+    if (typeL == typeR)
+        return Res{ left, right };
+
+    // Two options remaining - either left is an int, or right is an int, and it needs
+    // to be converted to a float
+    if (typeL == Integer) {
+        return Res{
+              .left = static_cast<float>(left.GetAs<int>())
+            , .right = right
+        };
+    }
+
+    if (typeR == Integer) {
+        return Res{
+              .left = left
+            , .right = static_cast<float>(right.GetAs<int>())
+        };
+    }
+    
+    return std::nullopt; // Should not be reachable
+}
+
+template<UnaryConversionTarget Target>
+static std::optional<Value> UnaryConversion(const Value& value) {
+    if constexpr (Target == UnaryConversionTarget::Numeric) {
+        if (value.GetType() != ValueType::Integer && value.GetType() != ValueType::Decimal) {
+            return value;
+        }
+    }
+}
+
+// Assumes left and right are the same type
+// Only operates on Arithmetic or Comparison operator classes
+// Accepts integer, floating, and strings
+static Value EvaluateBinaryExpr(const Value& left, const Value& right, TokenType op) {
+    using enum TokenType;
+
+    auto eval = [&]<typename T>() -> std::variant<T, bool> {
+        const T& l = left.GetAs<T>();
+        const T& r = right.GetAs<T>();
+    
+        // Special case the operations that aren't valid for strings
+        if constexpr (not std::same_as<T, std::string>) {
+            switch (op) {
+                // Arithmetic
+                case Minus: return l - r;
+                case Star:  return l * r;
+                case Slash: return l / r;
+                case StarStar: // Exponent
+                    if constexpr (std::same_as<T, int>) {
+                        if (r == 0) return 1; // 0^0 == 1
+                        if (r == 1) return l;
+                        if (l == 0) return 0;
+
+                        int val = l;
+
+                        for (int i = 1; i < r; i++) {
+                            val *= l;
+                        }
+
+                        return l;
+                    } else {
+                        return std::powf(l, r);
+                    }
+                default: ; // Fallthrough to next switch statement
+            }
+        }
+        
+        switch (op) {
+            case Plus:  return l + r;
+            // Comparison
+            case Greater:      return l > r;
+            case GreaterEqual: return l >= r;
+            case Less:         return l < r;
+            case LessEqual:    return l <= r;
+            default:
+                throw Error{
+                      .line = 0
+                    , .message = std::format(
+                          "Invalid binary operator {} for types {} and {}"
+                        , GetTokenRepresentation(op)
+                        , magic_enum::enum_name(left.GetType())
+                        , magic_enum::enum_name(right.GetType())
+                    )
+                };
+        }
+    };
+
+    if (left.GetType() == ValueType::Integer) {
+        if (GetTokenClass(op) == TokenClass::Arithmetic)
+            return std::get<int>(eval.operator()<int>());
+        else
+            return std::get<bool>(eval.operator()<int>());
+    } else if (left.GetType() == ValueType::Decimal) {
+        if (GetTokenClass(op) == TokenClass::Arithmetic)
+            return std::get<float>(eval.operator()<float>());
+        else
+            return std::get<bool>(eval.operator()<float>());
+    } else if (left.GetType() == ValueType::String) {
+        if (GetTokenClass(op) == TokenClass::Arithmetic)
+            return std::get<std::string>(eval.operator()<std::string>());
+        else
+            return std::get<bool>(eval.operator()<std::string>());
+    }
+
+    throw std::runtime_error(
+        std::format(
+              "Unexpectedly reached end of EvaluateBinaryExpr. {} {} {}"
+            , magic_enum::enum_name(left.GetType())
+            , GetTokenRepresentation(op)
+            , magic_enum::enum_name(right.GetType())
+        )
+    );
+}
+
+static bool EvaluateEquality(const Value& left, const Value& right, TokenType op) {
+    using enum ValueType;
+
+    ValueType leftT = left.GetType();
+    ValueType rightT = right.GetType();
+
+    // IILE to deal with == vs != in a concise way
+    bool result = [&]() {
+        if (leftT == rightT) {
+            switch (leftT) {
+                case Integer:    return left.GetAs<int>() == right.GetAs<int>();
+                case Decimal:    return left.GetAs<float>() == right.GetAs<float>();
+                case String:     return left.GetAs<std::string>() == right.GetAs<std::string>();
+                case Boolean:    return left.GetAs<bool>() == right.GetAs<bool>();
+                case Null:       return true;
+                case Lvalue:     throw std::runtime_error("Unextracted lvalue in equality");
+                case Function:   throw std::runtime_error("Function unhandled in equality");
+            }
+        }
+
+        // Handle the case of two different types being compared
+        if (leftT == Null || rightT == Null)
+            return false;
+
+        // Perform an implicit int->float conversion
+        if (left.IsArithmetic() && right.IsArithmetic()) {
+            auto res = NumericConversion(left, right);
+
+            return res->left.GetAs<float>() == res->right.GetAs<float>();
+        }
+
+        // Incomparable types
+        throw Error{
+              .line = 0
+            , .message = std::format(
+                  "Invalid '{}' comparison of types {} and {}"
+                , GetTokenRepresentation(op)
+                , magic_enum::enum_name(leftT)
+                , magic_enum::enum_name(rightT)
+            )
+        };
+    }();
+
+    // Invert the result if it's a !=
+    return result ^ (op == TokenType::BangEqual);
+}
+
+static Error BinaryConversionError(std::string_view name, TokenType op, const Value& left, const Value& right) {
+    return Error{
+          .line = 0
+        , .message = std::format(
+              "Can't perform {} for '{}' between types {} and {}"
+            , name
+            , GetTokenRepresentation(op)
+            , magic_enum::enum_name(left.GetType())
+            , magic_enum::enum_name(right.GetType())
+        )
+    };
+}
+
+Value core::ApplyBinary(const Value& left, const Value& right, TokenType op) {
+    using enum TokenClass;
+
+    // Special case equality to its own function
+    if (op == TokenType::EqualEqual || op == TokenType::BangEqual) {
+        return EvaluateEquality(left, right, op);
+    }
+
+    switch (GetTokenClass(op)) {
+        case Arithmetic:
+        case Comparison: {
+            if (left.GetType() == ValueType::String && right.GetType() == ValueType::String) {
+                // Support for binary expressions between strings
+                return EvaluateBinaryExpr(left, right, op);
+            } else {
+                // Support for binary expressions between numbers
+                auto res = NumericConversion(left, right);
+
+                if (not res)
+                    throw BinaryConversionError("numeric conversion", op, left, right);
+
+                return EvaluateBinaryExpr(res->left, res->right, op);
+            }
+        }
+        default:
+            throw std::runtime_error(std::format(
+                "Invalid binary operator {}", GetTokenRepresentation(op)
+            ));
+    }
+}
+
+Value core::ApplyUnary(const Value& operand, TokenType op) {
+    using enum TokenType;
+
+    switch (op) {
+        case Minus: {
+            if (not operand.IsArithmetic()) {
+                throw Error{
+                      .line = 0
+                    , .message = std::format(
+                          "Expected numeric operand for '-'. Got {}"
+                        , magic_enum::enum_name(operand.GetType())
+                    )
+                };
+            }
+
+            return EvaluateBinaryExpr(-1, operand, Star);
+        } 
+        case Not: {
+            if (operand.GetType() != ValueType::Boolean) {
+                throw Error{
+                      .line = 0
+                    , .message = std::format(
+                          "Expected boolean operand for 'not'. Got {}"
+                        , magic_enum::enum_name(operand.GetType())
+                    )
+                };
+            }
+
+            return not operand.GetAs<bool>();
+        }
+        default:
+            throw std::runtime_error(std::format(
+                  "Invalid unary operator {}"
+                , GetTokenRepresentation(op)
+            ));
+    }
+}
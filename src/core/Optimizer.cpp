@@ -0,0 +1,191 @@
+#include <climits>
+#include <exception>
+#include <optional>
+#include "core/Error.hpp"
+#include "core/Operators.hpp"
+#include "core/Optimizer.hpp"
+
+using namespace dxsh;
+using namespace core;
+
+namespace {
+    class ConstantFolder {
+        Program& program;
+
+        public:
+        explicit ConstantFolder(Program& program) : program(program) { }
+
+        void FoldStatements(StatementList statements) {
+            for (std::uint32_t i = 0; i < statements.count; i++) {
+                FoldStatement(program.stmtLists[statements.first + i]);
+            }
+        }
+
+        private:
+        void FoldStatement(StmtId stmt);
+        ExprId FoldExpr(ExprId expr);
+
+        // Only the value of a literal is known ahead of time. Lvalue literals
+        // are identifiers, whose value depends on the environment.
+        const Value* GetConstant(ExprId expr) const {
+            if (expr.GetKind() != ExprKind::Literal)
+                return nullptr;
+
+            const Value& value = program.literalExprs[expr.Index()].value;
+            return value.GetType() != ValueType::Lvalue ? &value : nullptr;
+        }
+
+        // Evaluates apply, or returns nullopt if it fails, leaving the failure
+        // to happen at runtime instead
+        template<typename Apply>
+        static std::optional<Value> TryApply(Apply&& apply) {
+            try {
+                return apply();
+            } catch (const Error&) {
+                return std::nullopt;
+            } catch (const std::exception&) {
+                return std::nullopt;
+            }
+        }
+
+        ExprId Replace(ExprId expr, std::optional<Value> folded) {
+            if (not folded)
+                return expr;
+
+            return program.Add(LiteralExpr(std::move(*folded)), program.GetLine(expr));
+        }
+    };
+}
+
+// Integer division traps on these rather than throwing, so they can't be tried
+static bool TrapsAtRuntime(const Value& left, const Value& right, TokenType op) {
+    if (op != TokenType::Slash || left.GetType() != ValueType::Integer || right.GetType() != ValueType::Integer)
+        return false;
+
+    const int divisor = right.GetAs<int>();
+    return divisor == 0 || (divisor == -1 && left.GetAs<int>() == INT_MIN);
+}
+
+void ConstantFolder::FoldStatement(StmtId stmt) {
+    using enum StmtKind;
+
+    const std::uint32_t index = stmt.Index();
+
+    switch (stmt.GetKind()) {
+        case Expr: {
+            auto& node = program.exprStmts[index];
+            node.expr = FoldExpr(node.expr);
+            break;
+        }
+        case Print: {
+            auto& node = program.printStmts[index];
+            node.expr = FoldExpr(node.expr);
+            break;
+        }
+        case VarDecl: {
+            auto& node = program.varDeclStmts[index];
+            node.value = FoldExpr(node.value);
+            break;
+        }
+        case Block:
+            FoldStatements(program.blockStmts[index].statements);
+            break;
+        case If: {
+            const IfStatement node = program.ifStmts[index];
+            program.ifStmts[index].condition = FoldExpr(node.condition);
+
+            FoldStatement(node.yesBranch);
+
+            if (node.noBranch)
+                FoldStatement(node.noBranch);
+
+            break;
+        }
+        case Func:
+            FoldStatements(program.funcStmts[index].statements);
+            break;
+        case Return: {
+            auto& node = program.returnStmts[index];
+
+            if (node.expr)
+                node.expr = FoldExpr(node.expr);
+
+            break;
+        }
+    }
+}
+
+// Folding only ever adds literals, so nodes of other kinds can be updated in
+// place, but must be reloaded after their children are folded
+ExprId ConstantFolder::FoldExpr(ExprId expr) {
+    using enum ExprKind;
+
+    const std::uint32_t index = expr.Index();
+
+    switch (expr.GetKind()) {
+        case Binary: {
+            const ExprId left = FoldExpr(program.binaryExprs[index].left);
+            const ExprId right = FoldExpr(program.binaryExprs[index].right);
+            const TokenType op = program.binaryExprs[index].op;
+
+            program.binaryExprs[index].left = left;
+            program.binaryExprs[index].right = right;
+
+            const Value* leftValue = GetConstant(left);
+            const Value* rightValue = GetConstant(right);
+
+            if (leftValue == nullptr || rightValue == nullptr || TrapsAtRuntime(*leftValue, *rightValue, op))
+                return expr;
+
+            return Replace(expr, TryApply([&]() { return ApplyBinary(*leftValue, *rightValue, op); }));
+        }
+        case Unary: {
+            const ExprId operand = FoldExpr(program.unaryExprs[index].operand);
+            const TokenType op = program.unaryExprs[index].op;
+
+            program.unaryExprs[index].operand = operand;
+
+            const Value* value = GetConstant(operand);
+
+            if (value == nullptr)
+                return expr;
+
+            return Replace(expr, TryApply([&]() { return ApplyUnary(*value, op); }));
+        }
+        case Grouping: {
+            const ExprId inner = FoldExpr(program.groupingExprs[index].expr);
+            program.groupingExprs[index].expr = inner;
+
+            return GetConstant(inner) != nullptr ? inner : expr;
+        }
+        case Literal:
+            return expr;
+        case Assignment: {
+            const ExprId target = FoldExpr(program.assignmentExprs[index].target);
+            const ExprId value = FoldExpr(program.assignmentExprs[index].value);
+
+            program.assignmentExprs[index].target = target;
+            program.assignmentExprs[index].value = value;
+            return expr;
+        }
+        case Call: {
+            const ExprId function = FoldExpr(program.callExprs[index].function);
+            const ExprList args = program.callExprs[index].args;
+
+            program.callExprs[index].function = function;
+
+            for (std::uint32_t i = 0; i < args.count; i++) {
+                const ExprId arg = FoldExpr(program.exprLists[args.first + i]);
+                program.exprLists[args.first + i] = arg;
+            }
+
+            return expr;
+        }
+    }
+
+    return expr;
+}
+
+void core::FoldConstants(Program& program, StatementList statements) {
+    ConstantFolder(program).FoldStatements(statements);
+}
@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include "core/Lexer.hpp"
+#include "core/ParallelLexer.hpp"
+#include "core/Scanner.hpp"
+
+using namespace dxsh;
+using namespace core;
+
+// Returns offsets where the lexer can safely start, beginning with 0. A line
+// start is safe if the source before it leaves the lexer outside of any
+// string literal or comment. Comments matter since a '"' in a comment doesn't
+// open a string, and a "//" in a string doesn't open a comment.
+static std::vector<std::size_t> FindSplitPoints(std::string_view source, std::size_t chunkCount) {
+    std::vector<std::size_t> splits{ 0 };
+    std::size_t chunkSize = source.size() / chunkCount;
+    std::size_t pos = 0; // Always outside of strings and comments
+
+    while (splits.size() < chunkCount && pos < source.size()) {
+        std::size_t wanted = std::max(pos, splits.size() * chunkSize);
+        std::size_t special = Scanner::FindQuoteOrSlash(source, pos);
+
+        // Everything up to the next '"' or '/' is plain code, so any newline in it splits cleanly
+        if (special > wanted) {
+            std::size_t newline = Scanner::FindNewline(source.substr(0, special), wanted);
+
+            if (newline < special) {
+                if (newline + 1 >= source.size())
+                    break;
+
+                splits.push_back(newline + 1);
+                pos = newline + 1;
+                continue;
+            }
+        }
+
+        if (special >= source.size())
+            break;
+
+        if (source[special] == '"') {
+            std::size_t closing = Scanner::FindQuote(source, special + 1);
+
+            // An unterminated string runs to the end, so no more splits are possible
+            if (closing >= source.size())
+                break;
+
+            pos = closing + 1;
+        } else if (special + 1 < source.size() && source[special + 1] == '/') {
+            // The newline ending a comment is back in code
+            pos = Scanner::FindNewline(source, special + 2);
+        } else {
+            pos = special + 1; // Division
+        }
+    }
+
+    return splits;
+}
+
+TokenBuffer core::LexParallel(std::string_view source, ErrorContext& errors, SymbolTable& symbols, unsigned threads, std::size_t minChunkSize) {
+    threads = static_cast<unsigned>(std::min<std::size_t>(threads, source.size() / std::max<std::size_t>(minChunkSize, 1)));
+
+    if (threads <= 1 || source.size() > std::numeric_limits<std::uint32_t>::max()) {
+        Lexer lexer(errors, symbols);
+        return lexer.Parse(source);
+    }
+
+    // More chunks than threads evens out chunks that lex slower than others
+    std::vector<std::size_t> splits = FindSplitPoints(source, threads * 4);
+    splits.push_back(source.size());
+
+    std::size_t chunkCount = splits.size() - 1;
+    std::vector<TokenBuffer> chunks(chunkCount);
+    std::vector<ErrorContext> chunkErrors(chunkCount);
+    std::vector<SymbolTable> chunkSymbols(chunkCount);
+    std::vector<std::vector<Symbol>> symbolMaps(chunkCount);
+
+    // Runs task(i) for every chunk, spread over the threads
+    auto forEachChunk = [&](auto task) {
+        std::atomic<std::size_t> nextChunk{ 0 };
+
+        auto worker = [&]() {
+            for (std::size_t i = nextChunk++; i < chunkCount; i = nextChunk++) {
+                task(i);
+            }
+        };
+
+        std::vector<std::jthread> pool;
+
+        for (unsigned i = 1; i < threads; i++) {
+            pool.emplace_back(worker);
+        }
+
+        worker();
+    };
+
+    auto chunkSource = [&](std::size_t i) {
+        return source.substr(splits[i], splits[i + 1] - splits[i]);
+    };
+
+    forEachChunk([&](std::size_t i) {
+        Lexer lexer(chunkErrors[i], chunkSymbols[i]);
+        chunks[i] = lexer.Parse(chunkSource(i));
+    });
+
+    TokenBuffer tokens(source);
+    const auto placements = tokens.Extend(chunks, splits);
+
+    // A chunk's first line is only known once the chunks before it are lexed, so
+    // chunks with errors are lexed again knowing it. This also gets lines right
+    // in the error messages that mention them.
+    //
+    // Symbols are interned chunk by chunk, in the order each chunk first saw
+    // them, which is the order a serial lex would have numbered them in.
+    for (std::size_t i = 0; i < chunkCount; i++) {
+        if (not chunkErrors[i].empty()) {
+            SymbolTable discarded;
+            Lexer lexer(errors, discarded);
+            lexer.Parse(chunkSource(i), static_cast<int>(placements[i].firstLine));
+        }
+
+        symbolMaps[i].reserve(chunkSymbols[i].Size());
+
+        for (Symbol local = 0; local < chunkSymbols[i].Size(); local++) {
+            symbolMaps[i].push_back(symbols.Intern(chunkSymbols[i].GetName(local)));
+        }
+    }
+
+    forEachChunk([&](std::size_t i) {
+        tokens.CopyIn(chunks[i], placements[i], symbolMaps[i]);
+    });
+
+    tokens.Push(TokenType::Eof, static_cast<std::uint32_t>(source.size()), 0);
+
+    return tokens;
+}
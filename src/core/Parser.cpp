@@ -1,28 +1,101 @@
+#include <utility>
+#include <magic_enum/magic_enum_container.hpp>
 #include "core/Parser.hpp"
 #include "core/AST.hpp"
 #include "core/Error.hpp"
+#include "core/Lexer.hpp"
 #include "core/Statement.hpp"
 #include "core/Value.hpp"
-#include <memory>
 
 using namespace dxsh;
 using namespace core;
 
-auto Parser::Parse(std::span<const Token> tokens) -> std::vector<StmtStore> {
-    this->tokens = tokens;
+auto Parser::Parse(const TokenBuffer& tokens) -> StatementList {
+    this->tokens = &tokens;
+    this->stream = nullptr;
+    this->script = tokens.Source();
+
+    return ParseProgram();
+}
+
+auto Parser::Parse(TokenStream& stream) -> StatementList {
+    Start(stream);
+    return ParseProgram();
+}
+
+void Parser::Start(TokenStream& stream) {
+    this->tokens = nullptr;
+    this->stream = &stream;
+    this->script = stream.Source();
+
     curPos = 0;
+    scratch.clear();
+}
 
-    std::vector<StmtStore> statements;
+auto Parser::ParseProgram() -> StatementList {
+    curPos = 0;
+    scratch.clear();
+
+    if (tokens) {
+        cursor = tokens->Begin();
+        current = tokens->Get(cursor);
+    }
 
     while (not IsAtEnd()) {
-        try {
-            statements.push_back(Block());
-        } catch (const Error& e) { 
-            errors->push_back(e);
-            Synchronize();
-        }
+        if (const StmtStore stmt = ParseTopLevel())
+            scratch.push_back(stmt);
     }
 
+    return TakeStatements(0);
+}
+
+auto Parser::ParseTopLevel() -> StmtStore {
+    const std::size_t parsed = scratch.size();
+    nesting = 0;
+
+    try {
+        return Block();
+    } catch (const Error& e) { 
+        // Drop whatever the failed statement left of its children
+        scratch.resize(parsed);
+
+        errors->push_back(e);
+        Synchronize();
+
+        return {};
+    }
+}
+
+auto Parser::ParseFunctionBody(std::uint32_t func, std::string_view script, SymbolTable& symbols) -> StatementList {
+    const SourceRange body = program->funcStmts[func].body;
+
+    ErrorContext lexErrors;
+    Lexer lexer(lexErrors, symbols);
+    TokenStream stream(lexer, script.substr(body.offset, body.length), body.line);
+
+    Start(stream);
+
+    // Functions nested in this body are parsed along with it
+    nesting = 1;
+
+    while (not IsAtEnd()) {
+        scratch.push_back(Block());
+    }
+
+    // Same as FuncStmt, the Eof token is on the line of the closing brace
+    if (scratch.empty() || scratch.back().GetKind() != StmtKind::Return) {
+        scratch.push_back(program->Add(ReturnStatement(ExprId{}), Peek().line));
+    }
+
+    const StatementList statements = TakeStatements(0);
+    program->funcStmts[func].statements = statements;
+
+    return statements;
+}
+
+StatementList Parser::TakeStatements(std::size_t first) {
+    StatementList statements = program->AddList(std::span<const StmtStore>(scratch).subspan(first));
+    scratch.resize(first);
     return statements;
 }
 
@@ -30,17 +103,17 @@ auto Parser::Block() -> StmtStore {
     using enum TokenType;
 
     if (MatchConsume(BraceL)) {
-        const Token& open = Previous();
-        std::vector<StmtStore> statements;
+        const Token open = Previous();
+        std::size_t first = scratch.size();
+        nesting++;
 
         while (not IsAtEnd()) {
             if (MatchConsume(BraceR)) {
-                const Token& close = Previous();
-
-                return std::make_unique<BlockStatement>(open, close, std::move(statements));
+                nesting--;
+                return program->Add(BlockStatement(TakeStatements(first)), open.line);
             }
 
-            statements.push_back(Block());
+            scratch.push_back(Block());
         }
 
         throw Error {
@@ -58,7 +131,6 @@ auto Parser::Block() -> StmtStore {
 auto Parser::Statement() -> StmtStore {
     using enum TokenType;
 
-    ExprStore expr;
     StmtStore stmt;
 
     if (MatchConsume(Print)) {
@@ -86,10 +158,7 @@ auto Parser::Statement() -> StmtStore {
 auto Parser::PrintStmt() -> StmtStore {
     int line = Previous().line;
 
-    return std::make_unique<PrintStatement>(
-          line
-        , Expression()
-    );
+    return program->Add(PrintStatement(Expression()), line);
 }
 
 auto Parser::VarDeclStmt() -> StmtStore {
@@ -97,7 +166,7 @@ auto Parser::VarDeclStmt() -> StmtStore {
 
     int line = Previous().line;
 
-    const auto& ident = TryConsume(Identifier, std::format(
+    const auto ident = TryConsume(Identifier, std::format(
             "Expected identifier after 'var', got {}"
         , Peek().GetRepresentation()
     ));
@@ -107,45 +176,32 @@ auto Parser::VarDeclStmt() -> StmtStore {
         , Peek().GetRepresentation()
     ));
 
-    return std::make_unique<VarDeclStatement>(
-          line
-        , ident
-        , Expression()
-    );
+    return program->Add(VarDeclStatement(ident.symbol, Expression()), line);
 }
 
 auto Parser::IfStmt() -> StmtStore {
     using enum TokenType;
 
-    const Token& ifToken = Previous();
+    int line = Previous().line;
     TryConsume(ParenL, "Expected '(' to start if statement's condition");
     auto condition = Expression();
     TryConsume(ParenR, "Expected ')' to close if statement's condition");
     auto yesBranch = Block();
 
     if (MatchConsume(Else)) {
-        const Token& elseToken = Previous();
         auto noBranch = Block();
 
-        return std::make_unique<IfStatement>(
-              ifToken, elseToken
-            , std::move(condition)
-            , std::move(yesBranch), std::move(noBranch)
-        );
+        return program->Add(IfStatement(condition, yesBranch, noBranch), line);
     } else {
-        return std::make_unique<IfStatement>(
-              ifToken, Token{}
-            , std::move(condition)
-            , std::move(yesBranch), nullptr
-        );
+        return program->Add(IfStatement(condition, yesBranch, StmtId{}), line);
     }
 }
 
 auto Parser::FuncStmt() -> StmtStore {
     using enum TokenType;
 
-    const Token& funcToken = Previous();
-    const Token& funcName = TryConsume(
+    int line = Previous().line;
+    const Token funcName = TryConsume(
           Identifier
         , std::format(
               "Expected identifier for function name, got '{}' instead"
@@ -161,9 +217,9 @@ auto Parser::FuncStmt() -> StmtStore {
         )
     );
 
-    std::vector<Token> params = ParseList(Comma, [this]() -> std::optional<Token> {
+    std::vector<Symbol> params = ParseList(Comma, [this]() -> std::optional<Symbol> {
         if (Peek().type == Identifier)
-            return Advance();
+            return Advance().symbol;
         else
             return std::nullopt;
     });
@@ -176,7 +232,7 @@ auto Parser::FuncStmt() -> StmtStore {
         )
     );
 
-    TryConsume(
+    const Token open = TryConsume(
           BraceL
         , std::format(
               "Expected '{{' after function parameter list, got '{}' instead"
@@ -184,16 +240,30 @@ auto Parser::FuncStmt() -> StmtStore {
         )
     );
 
-    std::vector<StmtStore> statements;
+    if (deferBodies && nesting == 0) {
+        const SourceRange body = SkipFunctionBody(open);
+
+        return program->Add(FuncStatement(
+              funcName.symbol
+            , program->AddList(std::span<const Symbol>(params))
+            , StatementList{}
+            , body
+        ), line);
+    }
+
+    std::size_t first = scratch.size();
+    nesting++;
 
     while (not IsAtEnd() and Peek().type != BraceR) {
-        statements.push_back(Block());
+        scratch.push_back(Block());
     }
 
+    nesting--;
+
     // Insert a void return statement (return;) if there isn't a
     // return statement at the end of the function block
-    if (statements.size() == 0 || !dynamic_cast<ReturnStatement*>(statements.back().get())) {
-        statements.push_back(std::make_unique<ReturnStatement>(Peek().line, nullptr));
+    if (scratch.size() == first || scratch.back().GetKind() != StmtKind::Return) {
+        scratch.push_back(program->Add(ReturnStatement(ExprId{}), Peek().line));
     }
 
     TryConsume(
@@ -204,110 +274,111 @@ auto Parser::FuncStmt() -> StmtStore {
         )
     );
 
-    return std::make_unique<FuncStatement>(
-          funcToken
-        , funcName
-        , std::move(params)
-        , std::move(statements)
-    );
+    return program->Add(FuncStatement(
+          funcName.symbol
+        , program->AddList(std::span<const Symbol>(params))
+        , TakeStatements(first)
+    ), line);
 }
 
 auto Parser::ReturnStmt() -> StmtStore {
     int line = Previous().line;
 
-    return std::make_unique<ReturnStatement>(
-          line
-        , Peek().type != TokenType::Semicolon ? Expression() : nullptr
-    );
+    return program->Add(ReturnStatement(
+          Peek().type != TokenType::Semicolon ? Expression() : ExprId{}
+    ), line);
 }
 
 auto Parser::ExprStmt() -> StmtStore {
     int line = Peek().line;
 
-    return std::make_unique<ExprStatement>(
-          line
-        , Expression()
-    );
+    return program->Add(ExprStatement(Expression()), line);
 }
 
-auto Parser::Expression() -> ExprStore {
-    return Assignment();
-} 
+// Precedence of each token when it follows an operand, None if it can't
+static constexpr auto infixPrecedences = []() {
+    using enum TokenType;
 
-auto Parser::Assignment() -> ExprStore {
-    auto expr = Equality();
+    magic_enum::containers::array<TokenType, Precedence> precedences{};
+    precedences.fill(Precedence::None);
+
+    precedences[Equal]        = Precedence::Assignment;
+    precedences[EqualEqual]   = Precedence::Equality;
+    precedences[BangEqual]    = Precedence::Equality;
+    precedences[Greater]      = Precedence::Comparison;
+    precedences[GreaterEqual] = Precedence::Comparison;
+    precedences[Less]         = Precedence::Comparison;
+    precedences[LessEqual]    = Precedence::Comparison;
+    precedences[Plus]         = Precedence::Term;
+    precedences[Minus]        = Precedence::Term;
+    precedences[Star]         = Precedence::Factor;
+    precedences[Slash]        = Precedence::Factor;
+    precedences[ParenL]       = Precedence::Call;
+
+    return precedences;
+}();
+
+static Precedence NextTighter(Precedence precedence) {
+    return static_cast<Precedence>(static_cast<std::uint8_t>(precedence) + 1);
+}
 
-    if (MatchConsume(TokenType::Equal)) {
-        const auto& equal = Previous();
-        
-        return std::make_unique<AssignmentExpr>(std::move(expr), Assignment(), equal);
-    }
+auto Parser::Expression() -> ExprStore {
+    return ParseExpression(Precedence::Assignment);
+}
 
-    return expr;
-} 
+auto Parser::ParseExpression(Precedence minPrecedence) -> ExprStore {
+    using enum TokenType;
 
+    auto expr = Prefix();
 
-auto Parser::Equality() -> ExprStore {
-    return ParseBinaryExpression<&Parser::Comparison>(
-          TokenType::EqualEqual
-        , TokenType::BangEqual
-    );
-}
+    while (true) {
+        const TokenType type = PeekType();
+        const Precedence precedence = infixPrecedences[type];
 
-auto Parser::Comparison() -> ExprStore {
-   return ParseBinaryExpression<&Parser::Term>(
-          TokenType::Greater
-        , TokenType::GreaterEqual
-        , TokenType::Less
-        , TokenType::LessEqual
-    );
-}
+        if (precedence == Precedence::None || precedence < minPrecedence)
+            break;
 
-auto Parser::Term() -> ExprStore {
-    return ParseBinaryExpression<&Parser::Factor>(
-          TokenType::Plus
-        , TokenType::Minus
-    );
-}
+        const auto op = Advance();
+
+        if (type == ParenL) {
+            // Keep parsing function calls to support things like a()()()
+            expr = FinishCall(expr);
+        } else if (type == Equal) {
+            // Right associative, so a = b = c assigns c to b first
+            expr = program->Add(AssignmentExpr(expr, ParseExpression(Precedence::Assignment)), op.line);
+        } else {
+            // Left associative, so the right side only takes tighter operators
+            expr = program->Add(BinaryExpr(
+                  expr                                     // Left branch
+                , ParseExpression(NextTighter(precedence)) // Right branch
+                , type                                     // Operator
+            ), op.line);
+        }
+    }
 
-auto Parser::Factor() -> ExprStore {
-    return ParseBinaryExpression<&Parser::Unary>(
-          TokenType::Star
-        , TokenType::Slash
-    );
+    return expr;
 }
 
-auto Parser::Unary() -> ExprStore {
+auto Parser::Prefix() -> ExprStore {
     if (MatchConsume(TokenType::Not, TokenType::Minus)) {
-        const auto& op = Previous();
+        const auto op = Previous();
 
-        return std::make_unique<UnaryExpr>(
-              Unary()    // Operand
-            , op
-        );
+        return program->Add(UnaryExpr(
+              ParseExpression(Precedence::Unary) // Operand
+            , op.type
+        ), op.line);
     }
 
-    return Call();
+    return Primary();
 }
 
-auto Parser::Call() -> ExprStore {
-    auto expr = Primary();
-
-    // Keep parsing function calls to support things like a()()()
-    while (true) {
-        if (not MatchConsume(TokenType::ParenL)) {
-            break;
-        }
-
-        const auto& parenL = this->Previous();
-        auto args = Arguments();
+auto Parser::FinishCall(ExprStore function) -> ExprStore {
+    const auto parenL = Previous();
+    auto args = Arguments();
 
-        TryConsume(TokenType::ParenR, std::format("Expected ) after function call arguments, got '{}' instead", Peek().GetRepresentation()));
-    
-        expr = std::make_unique<CallExpr>(std::move(expr), std::move(args), parenL);
-    }
+    TryConsume(TokenType::ParenR, std::format("Expected ) after function call arguments, got '{}' instead", Peek().GetRepresentation()));
 
-    return expr;
+    return program->Add(CallExpr(function, program->AddList(std::span<const ExprStore>(args))), parenL.line);
 }
 
 auto Parser::Arguments() -> std::vector<ExprStore> {
@@ -324,31 +395,29 @@ auto Parser::Arguments() -> std::vector<ExprStore> {
 }
 
 auto Parser::Primary() -> ExprStore {
-    const Token& curToken = Peek();
+    const Token curToken = Peek();
+    const int line = curToken.line;
 
-    if (MatchConsume(TokenType::Null))  return std::make_unique<LiteralExpr>(curToken);
-    if (MatchConsume(TokenType::True))  return std::make_unique<LiteralExpr>(true, curToken);
-    if (MatchConsume(TokenType::False)) return std::make_unique<LiteralExpr>(false, curToken);
+    if (MatchConsume(TokenType::Null))  return program->Add(LiteralExpr(Value{}), line);
+    if (MatchConsume(TokenType::True))  return program->Add(LiteralExpr(true), line);
+    if (MatchConsume(TokenType::False)) return program->Add(LiteralExpr(false), line);
 
     if (MatchConsume(TokenType::Integer)) 
-        return std::make_unique<LiteralExpr>(std::get<int>(curToken.literal), curToken);
+        return program->Add(LiteralExpr(std::get<int>(curToken.literal)), line);
 
     if (MatchConsume(TokenType::Decimal)) 
-        return std::make_unique<LiteralExpr>(std::get<float>(curToken.literal), curToken);
+        return program->Add(LiteralExpr(std::get<float>(curToken.literal)), line);
 
     if (MatchConsume(TokenType::String))
-        return std::make_unique<LiteralExpr>(std::get<std::string>(curToken.literal), curToken);
+        return program->Add(LiteralExpr(std::string(std::get<std::string_view>(curToken.literal))), line);
 
     if (MatchConsume(TokenType::Identifier))
-        return std::make_unique<LiteralExpr>(
-              Lvalue{curToken.line, curToken.lexeme}
-            , curToken
-        );
+        return program->Add(LiteralExpr(Lvalue{line, curToken.symbol, curToken.lexeme}), line);
 
     if (MatchConsume(TokenType::ParenL)) {
         auto expr = Expression();
         TryConsume(TokenType::ParenR, "Expected ')' after parenthetical expression");
-        return std::make_unique<GroupingExpr>(std::move(expr));
+        return program->Add(GroupingExpr(expr), line);
     }
 
     throw Error{
@@ -357,6 +426,41 @@ auto Parser::Primary() -> ExprStore {
     };
 }
 
+SourceRange Parser::SkipFunctionBody(const Token& open) {
+    using enum TokenType;
+
+    const char* start = open.lexeme.data() + open.lexeme.size();
+    int depth = 1;
+
+    while (not IsAtEnd()) {
+        const TokenType type = PeekType();
+
+        if (type == BraceR && --depth == 0) {
+            const char* end = Peek().lexeme.data();
+            Advance();
+
+            return SourceRange{
+                  .offset = static_cast<std::uint32_t>(start - script.data())
+                , .length = static_cast<std::uint32_t>(end - start)
+                , .line = open.line
+            };
+        }
+
+        if (type == BraceL)
+            depth++;
+
+        Advance();
+    }
+
+    throw Error{
+          .line = Peek().line
+        , .message = std::format(
+              "Expected '}}' after function definition, got '{}' instead"
+            , Peek().GetRepresentation()
+        )
+    };
+}
+
 void Parser::Synchronize() {
     using enum TokenType;
 
@@ -378,14 +482,21 @@ void Parser::Synchronize() {
     }
 }
 
-const Token& Parser::Advance() {
-    if (not IsAtEnd())
-        curPos++;
+Token Parser::Advance() {
+    if (IsAtEnd())
+        return Previous();
+
+    curPos++;
 
-    return Previous();
+    if (stream)
+        return stream->Get(curPos - 1);
+
+    tokens->Advance(cursor);
+    previous = std::exchange(current, tokens->Get(cursor));
+    return previous;
 }
 
-const Token& Parser::TryConsume(TokenType type, std::string_view error) {
+Token Parser::TryConsume(TokenType type, std::string_view error) {
     if (Check(type)) return Advance();
 
     throw Error{
@@ -394,21 +505,25 @@ const Token& Parser::TryConsume(TokenType type, std::string_view error) {
     };
 }
 
-const Token& Parser::Previous() const {
-    return tokens[curPos - 1];
+Token Parser::Previous() const {
+    return stream ? stream->Get(curPos - 1) : previous;
+}
+
+Token Parser::Peek() const {
+    return stream ? stream->Get(curPos) : current;
 }
 
-const Token& Parser::Peek() const {
-    return tokens[curPos];
+TokenType Parser::PeekType() const {
+    return stream ? stream->Get(curPos).type : tokens->GetType(curPos);
 }
 
 bool Parser::Check(TokenType type) const {
     if (IsAtEnd())
         return false;
 
-    return Peek().type == type;
+    return PeekType() == type;
 }
 
 bool Parser::IsAtEnd() const {
-    return Peek().type == TokenType::Eof;
+    return PeekType() == TokenType::Eof;
 }
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include "core/Program.hpp"
+
+using namespace dxsh;
+using namespace core;
+
+std::size_t Program::NodeCount() const {
+    return binaryExprs.size() + unaryExprs.size() + groupingExprs.size()
+        + literalExprs.size() + assignmentExprs.size() + callExprs.size()
+        + exprStmts.size() + printStmts.size() + varDeclStmts.size()
+        + blockStmts.size() + ifStmts.size() + funcStmts.size() + returnStmts.size();
+}
+
+template<typename ProgramT, typename F>
+static void ForEachPool(ProgramT& program, F&& f) {
+    f(program.binaryExprs);
+    f(program.unaryExprs);
+    f(program.groupingExprs);
+    f(program.literalExprs);
+    f(program.assignmentExprs);
+    f(program.callExprs);
+
+    f(program.exprStmts);
+    f(program.printStmts);
+    f(program.varDeclStmts);
+    f(program.blockStmts);
+    f(program.ifStmts);
+    f(program.funcStmts);
+    f(program.returnStmts);
+
+    f(program.exprLists);
+    f(program.stmtLists);
+    f(program.symbolLists);
+
+    for (auto& lines : program.exprLines) f(lines);
+    for (auto& lines : program.stmtLines) f(lines);
+}
+
+Program::Checkpoint Program::GetCheckpoint() const {
+    Checkpoint checkpoint;
+    std::size_t i = 0;
+
+    ForEachPool(*this, [&](const auto& pool) {
+        checkpoint[i++] = pool.size();
+    });
+
+    return checkpoint;
+}
+
+void Program::Rollback(const Checkpoint& checkpoint) {
+    std::size_t i = 0;
+
+    // Nodes have no default constructor, so pools can only shrink through erase
+    ForEachPool(*this, [&](auto& pool) {
+        pool.erase(pool.begin() + checkpoint[i++], pool.end());
+    });
+}
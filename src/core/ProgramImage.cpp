@@ -0,0 +1,605 @@
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <magic_enum/magic_enum.hpp>
+
+#include "core/ProgramImage.hpp"
+
+#ifndef DXSH_VERSION
+    #define DXSH_VERSION "dev"
+#endif
+
+using namespace dxsh;
+using namespace core;
+
+// Bump whenever the encoding changes in a way the node layouts don't show
+static constexpr std::uint32_t FormatVersion = 4;
+static constexpr std::array<char, 4> Magic = { 'D', 'X', 'C', '\0' };
+
+struct ImageHeader {
+    std::array<char, 4> magic;
+    std::uint32_t formatVersion;
+    std::uint64_t key;
+    std::uint64_t sourceSize;
+    std::uint64_t sourceDigest; // Independent of the key
+    std::uint64_t payloadSize;
+    std::uint64_t checksum;
+};
+
+// Every pool and table of a Program that is stored byte for byte, in image order.
+// Literals hold Values, so they are encoded separately.
+template<typename ProgramT, typename F>
+static void ForEachPlainPool(ProgramT& program, F&& f) {
+    f(program.binaryExprs);
+    f(program.unaryExprs);
+    f(program.groupingExprs);
+    f(program.assignmentExprs);
+    f(program.callExprs);
+
+    f(program.exprStmts);
+    f(program.printStmts);
+    f(program.varDeclStmts);
+    f(program.blockStmts);
+    f(program.ifStmts);
+    f(program.funcStmts);
+    f(program.returnStmts);
+
+    f(program.exprLists);
+    f(program.stmtLists);
+    f(program.symbolLists);
+
+    for (auto& lines : program.exprLines) f(lines);
+    for (auto& lines : program.stmtLines) f(lines);
+}
+
+namespace {
+    struct CorruptImage { };
+
+    class Writer {
+        std::string& out;
+
+        public:
+        explicit Writer(std::string& out) : out(out) { }
+
+        template<typename T>
+        void Put(const T& value) {
+            static_assert(std::is_trivially_copyable_v<T>);
+            out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        void PutBytes(std::string_view bytes) {
+            Put(static_cast<std::uint32_t>(bytes.size()));
+            out.append(bytes);
+        }
+
+        template<typename T>
+        void PutArray(const std::vector<T>& elements) {
+            static_assert(std::is_trivially_copyable_v<T>);
+
+            Put(static_cast<std::uint32_t>(elements.size()));
+            out.append(reinterpret_cast<const char*>(elements.data()), elements.size() * sizeof(T));
+        }
+    };
+
+    class Reader {
+        std::string_view in;
+        std::size_t pos{};
+
+        std::string_view Take(std::size_t size) {
+            if (size > in.size() - pos)
+                throw CorruptImage{};
+
+            std::string_view bytes = in.substr(pos, size);
+            pos += size;
+            return bytes;
+        }
+
+        public:
+        explicit Reader(std::string_view in) : in(in) { }
+
+        bool AtEnd() const { return pos == in.size(); }
+
+        template<typename T>
+        T Get() {
+            static_assert(std::is_trivially_copyable_v<T>);
+
+            std::array<char, sizeof(T)> raw;
+            std::memcpy(raw.data(), Take(sizeof(T)).data(), sizeof(T));
+            return std::bit_cast<T>(raw);
+        }
+
+        std::string_view GetBytes() {
+            return Take(Get<std::uint32_t>());
+        }
+
+        // Appends to elements, which don't need to be default constructible
+        template<typename T>
+        void GetArray(std::vector<T>& elements) {
+            const auto count = Get<std::uint32_t>();
+            const std::string_view bytes = Take(std::size_t(count) * sizeof(T));
+
+            elements.reserve(elements.size() + count);
+
+            for (std::size_t i = 0; i < count; i++) {
+                std::array<char, sizeof(T)> raw;
+                std::memcpy(raw.data(), bytes.data() + i * sizeof(T), sizeof(T));
+                elements.push_back(std::bit_cast<T>(raw));
+            }
+        }
+    };
+}
+
+static void PutValue(Writer& out, const Value& value) {
+    using enum ValueType;
+
+    out.Put(value.GetType());
+
+    switch (value.GetType()) {
+        case Null:     break;
+        case Integer:  out.Put(value.GetAs<int>()); break;
+        case Decimal:  out.Put(value.GetAs<float>()); break;
+        case String:   out.PutBytes(value.GetAs<std::string>()); break;
+        case Boolean:  out.Put(value.GetAs<bool>()); break;
+        case Lvalue: {
+            const auto& lvalue = value.GetAs<core::Lvalue>();
+            out.Put(lvalue.lineOfRef);
+            out.Put(lvalue.symbol);
+            out.Put(lvalue.binding);
+            break;
+        }
+        case Function:
+            throw std::logic_error("Function values can't appear in literals");
+    }
+}
+
+static Value GetValue(Reader& in, const SymbolTable& symbols) {
+    using enum ValueType;
+
+    switch (in.Get<ValueType>()) {
+        case Null:     return {};
+        case Integer:  return in.Get<int>();
+        case Decimal:  return in.Get<float>();
+        case String:   return std::string(in.GetBytes());
+        case Boolean:  return in.Get<bool>();
+        case Lvalue: {
+            const int line = in.Get<int>();
+            const Symbol symbol = in.Get<Symbol>();
+            const Binding binding = in.Get<Binding>();
+
+            if (symbol >= symbols.Size())
+                throw CorruptImage{};
+
+            return core::Lvalue{ line, symbol, symbols.GetName(symbol), binding };
+        }
+        default:
+            throw CorruptImage{};
+    }
+}
+
+std::uint64_t core::HashBytes(std::string_view bytes, std::uint64_t seed) {
+    constexpr std::uint64_t Multiplier = 0x9E3779B97F4A7C15;
+
+    auto mix = [](std::uint64_t hash, std::uint64_t word) {
+        hash = (hash ^ word) * Multiplier;
+        return hash ^ (hash >> 29);
+    };
+
+    std::uint64_t hash = seed ^ (bytes.size() * Multiplier);
+    std::size_t i = 0;
+
+    for (; i + 8 <= bytes.size(); i += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, bytes.data() + i, 8);
+        hash = mix(hash, word);
+    }
+
+    std::uint64_t tail = 0;
+    std::memcpy(&tail, bytes.data() + i, bytes.size() - i);
+
+    return mix(mix(hash, tail), Multiplier);
+}
+
+// FNV-1a, which shares nothing with HashBytes, so a source that collides with
+// another's key is still told apart
+static std::uint64_t DigestSource(std::string_view source) {
+    std::uint64_t hash = 0xCBF29CE484222325;
+
+    for (const char c : source) {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001B3;
+    }
+
+    return hash;
+}
+
+// Whether every node id, list range and source range in a loaded program is in
+// bounds, so that running it can't read past a pool or the source
+static bool IsInBounds(const Program& program, std::size_t symbolCount, std::size_t sourceSize) {
+    const auto exprLinesMatch = [&](ExprKind kind, std::size_t size) {
+        return program.exprLines[static_cast<std::size_t>(kind)].size() == size;
+    };
+
+    const auto stmtLinesMatch = [&](StmtKind kind, std::size_t size) {
+        return program.stmtLines[static_cast<std::size_t>(kind)].size() == size;
+    };
+
+    // With those matching, the line tables give the size of the pool of each kind
+    if (not exprLinesMatch(ExprKind::Binary, program.binaryExprs.size())
+        || not exprLinesMatch(ExprKind::Unary, program.unaryExprs.size())
+        || not exprLinesMatch(ExprKind::Grouping, program.groupingExprs.size())
+        || not exprLinesMatch(ExprKind::Literal, program.literalExprs.size())
+        || not exprLinesMatch(ExprKind::Assignment, program.assignmentExprs.size())
+        || not exprLinesMatch(ExprKind::Call, program.callExprs.size())
+        || not stmtLinesMatch(StmtKind::Expr, program.exprStmts.size())
+        || not stmtLinesMatch(StmtKind::Print, program.printStmts.size())
+        || not stmtLinesMatch(StmtKind::VarDecl, program.varDeclStmts.size())
+        || not stmtLinesMatch(StmtKind::Block, program.blockStmts.size())
+        || not stmtLinesMatch(StmtKind::If, program.ifStmts.size())
+        || not stmtLinesMatch(StmtKind::Func, program.funcStmts.size())
+        || not stmtLinesMatch(StmtKind::Return, program.returnStmts.size()))
+        return false;
+
+    const auto isExpr = [&](ExprId expr) {
+        const auto kind = static_cast<std::size_t>(expr.GetKind());
+        return kind < program.exprLines.size() && expr.Index() < program.exprLines[kind].size();
+    };
+
+    const auto isStmt = [&](StmtId stmt) {
+        const auto kind = static_cast<std::size_t>(stmt.GetKind());
+        return kind < program.stmtLines.size() && stmt.Index() < program.stmtLines[kind].size();
+    };
+
+    // Ids that may refer to no node
+    const auto isOptionalExpr = [&](ExprId expr) { return not expr || isExpr(expr); };
+    const auto isOptionalStmt = [&](StmtId stmt) { return not stmt || isStmt(stmt); };
+
+    const auto isSymbol = [&](Symbol symbol) { return symbol < symbolCount; };
+
+    // List elements are checked on their own, so ranges only need to fit
+    const auto isRange = []<typename T>(const std::vector<T>& pool, IndexRange<T> range) {
+        return std::uint64_t(range.first) + range.count <= pool.size();
+    };
+
+    const auto isOp = [](TokenType op) { return magic_enum::enum_contains(op); };
+
+    return std::ranges::all_of(program.exprLists, isExpr)
+        && std::ranges::all_of(program.stmtLists, isStmt)
+        && std::ranges::all_of(program.symbolLists, isSymbol)
+        && std::ranges::all_of(program.binaryExprs, [&](const BinaryExpr& expr) {
+            return isExpr(expr.left) && isExpr(expr.right) && isOp(expr.op);
+        })
+        && std::ranges::all_of(program.unaryExprs, [&](const UnaryExpr& expr) {
+            return isExpr(expr.operand) && isOp(expr.op);
+        })
+        && std::ranges::all_of(program.groupingExprs, [&](const GroupingExpr& expr) {
+            return isExpr(expr.expr);
+        })
+        && std::ranges::all_of(program.assignmentExprs, [&](const AssignmentExpr& expr) {
+            return isExpr(expr.target) && isExpr(expr.value);
+        })
+        && std::ranges::all_of(program.callExprs, [&](const CallExpr& expr) {
+            return isExpr(expr.function) && isRange(program.exprLists, expr.args);
+        })
+        && std::ranges::all_of(program.exprStmts, [&](const ExprStatement& stmt) {
+            return isExpr(stmt.expr);
+        })
+        && std::ranges::all_of(program.printStmts, [&](const PrintStatement& stmt) {
+            return isExpr(stmt.expr);
+        })
+        && std::ranges::all_of(program.varDeclStmts, [&](const VarDeclStatement& stmt) {
+            return isSymbol(stmt.symbol) && isExpr(stmt.value);
+        })
+        && std::ranges::all_of(program.blockStmts, [&](const BlockStatement& stmt) {
+            return isRange(program.stmtLists, stmt.statements) && isRange(program.symbolLists, stmt.slots);
+        })
+        && std::ranges::all_of(program.ifStmts, [&](const IfStatement& stmt) {
+            return isExpr(stmt.condition) && isStmt(stmt.yesBranch) && isOptionalStmt(stmt.noBranch);
+        })
+        && std::ranges::all_of(program.funcStmts, [&](const FuncStatement& stmt) {
+            return isSymbol(stmt.name)
+                && isRange(program.symbolLists, stmt.params)
+                && isRange(program.stmtLists, stmt.statements)
+                && isRange(program.symbolLists, stmt.slots)
+                && std::uint64_t(stmt.body.offset) + stmt.body.length <= sourceSize;
+        })
+        && std::ranges::all_of(program.returnStmts, [&](const ReturnStatement& stmt) {
+            return isOptionalExpr(stmt.expr);
+        });
+}
+
+namespace {
+    // Walks a loaded program from its top statements, checking that every
+    // reachable node is reached once, so evaluation can't loop through the
+    // nodes, and that every binding fits the scopes around it. Ids must
+    // already be in bounds.
+    class TreeChecker {
+        const Program& program;
+
+        std::array<std::vector<bool>, magic_enum::enum_count<ExprKind>()> seenExprs;
+        std::array<std::vector<bool>, magic_enum::enum_count<StmtKind>()> seenStmts;
+
+        // Slot counts of the scopes of the function being checked, innermost last
+        std::vector<std::size_t> scopes;
+
+        public:
+        explicit TreeChecker(const Program& program) : program(program) {
+            for (std::size_t kind = 0; kind < seenExprs.size(); kind++) {
+                seenExprs[kind].resize(program.exprLines[kind].size());
+            }
+
+            for (std::size_t kind = 0; kind < seenStmts.size(); kind++) {
+                seenStmts[kind].resize(program.stmtLines[kind].size());
+            }
+        }
+
+        bool CheckStatements(StatementList statements) {
+            for (const StmtId stmt : program.Get(statements)) {
+                if (not CheckStmt(stmt))
+                    return false;
+            }
+
+            return true;
+        }
+
+        private:
+        static bool FirstVisit(std::vector<bool>& seen, std::uint32_t index) {
+            if (seen[index])
+                return false;
+
+            seen[index] = true;
+            return true;
+        }
+
+        // Declarations are always made in the innermost scope, or globally
+        bool IsBinding(const Binding& binding, bool declaration) const {
+            using enum Binding::Kind;
+
+            switch (binding.kind) {
+                case Dynamic:
+                    return not declaration;
+                case Global:
+                    return true;
+                case Local:
+                    return binding.hops < scopes.size()
+                        && (not declaration || binding.hops == 0)
+                        && binding.slot < scopes[scopes.size() - 1 - binding.hops];
+            }
+
+            return false;
+        }
+
+        bool CheckStmt(StmtId stmt);
+        bool CheckExpr(ExprId expr);
+    };
+}
+
+bool TreeChecker::CheckStmt(StmtId stmt) {
+    using enum StmtKind;
+
+    const std::uint32_t index = stmt.Index();
+
+    if (not FirstVisit(seenStmts[static_cast<std::size_t>(stmt.GetKind())], index))
+        return false;
+
+    switch (stmt.GetKind()) {
+        case Expr:
+            return CheckExpr(program.exprStmts[index].expr);
+        case Print:
+            return CheckExpr(program.printStmts[index].expr);
+        case VarDecl: {
+            const VarDeclStatement& node = program.varDeclStmts[index];
+            return CheckExpr(node.value) && IsBinding(node.binding, true);
+        }
+        case Block: {
+            const BlockStatement& node = program.blockStmts[index];
+
+            scopes.push_back(node.slots.count);
+            const bool valid = CheckStatements(node.statements);
+            scopes.pop_back();
+
+            return valid;
+        }
+        case If: {
+            const IfStatement& node = program.ifStmts[index];
+
+            return CheckExpr(node.condition)
+                && CheckStmt(node.yesBranch)
+                && (not node.noBranch || CheckStmt(node.noBranch));
+        }
+        case Func: {
+            const FuncStatement& node = program.funcStmts[index];
+
+            // Parameters take the first slots of the function, which are only
+            // laid out once its body is parsed
+            if (not IsBinding(node.binding, true) || (node.IsParsed() && node.params.count > node.slots.count))
+                return false;
+
+            // Names of the enclosing scopes are looked up by name from the body
+            std::vector<std::size_t> outer = std::exchange(scopes, { node.slots.count });
+            const bool valid = CheckStatements(node.statements);
+            scopes = std::move(outer);
+
+            return valid;
+        }
+        case Return: {
+            const ExprId expr = program.returnStmts[index].expr;
+            return not expr || CheckExpr(expr);
+        }
+    }
+
+    return false;
+}
+
+bool TreeChecker::CheckExpr(ExprId expr) {
+    using enum ExprKind;
+
+    const std::uint32_t index = expr.Index();
+
+    if (not FirstVisit(seenExprs[static_cast<std::size_t>(expr.GetKind())], index))
+        return false;
+
+    switch (expr.GetKind()) {
+        case Binary:
+            return CheckExpr(program.binaryExprs[index].left) && CheckExpr(program.binaryExprs[index].right);
+        case Unary:
+            return CheckExpr(program.unaryExprs[index].operand);
+        case Grouping:
+            return CheckExpr(program.groupingExprs[index].expr);
+        case Literal: {
+            const Value& value = program.literalExprs[index].value;
+            return value.GetType() != ValueType::Lvalue || IsBinding(value.GetAs<Lvalue>().binding, false);
+        }
+        case Assignment:
+            return CheckExpr(program.assignmentExprs[index].target) && CheckExpr(program.assignmentExprs[index].value);
+        case Call: {
+            const CallExpr& node = program.callExprs[index];
+
+            if (not CheckExpr(node.function))
+                return false;
+
+            for (const ExprId arg : program.Get(node.args)) {
+                if (not CheckExpr(arg))
+                    return false;
+            }
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::uint64_t core::ProgramImageKey(std::string_view source, bool optimized) {
+    static const std::uint64_t seed = []() {
+        // Any change to the version, encoding or node layouts gives new keys
+        std::string build = DXSH_VERSION;
+        Writer out(build);
+
+        out.Put(FormatVersion);
+        out.Put(magic_enum::enum_count<TokenType>());
+        out.Put(sizeof(Value));
+
+        const Program layout;
+
+        ForEachPlainPool(layout, [&]<typename T>(const std::vector<T>&) {
+            out.Put(sizeof(T));
+            out.Put(alignof(T));
+        });
+
+        return HashBytes(build);
+    }();
+
+    return HashBytes(source, seed + optimized);
+}
+
+std::string core::SaveProgramImage(
+      const Program& program
+    , StatementList statements
+    , const SymbolTable& symbols
+    , std::uint64_t key
+    , std::string_view source
+) {
+    std::string payload;
+    Writer out(payload);
+
+    out.Put(static_cast<std::uint32_t>(symbols.Size()));
+
+    for (Symbol symbol = 0; symbol < symbols.Size(); symbol++) {
+        out.PutBytes(symbols.GetName(symbol));
+    }
+
+    out.Put(statements);
+
+    ForEachPlainPool(program, [&](const auto& pool) {
+        out.PutArray(pool);
+    });
+
+    out.Put(static_cast<std::uint32_t>(program.literalExprs.size()));
+
+    for (const LiteralExpr& literal : program.literalExprs) {
+        PutValue(out, literal.value);
+    }
+
+    const ImageHeader header{
+          .magic = Magic
+        , .formatVersion = FormatVersion
+        , .key = key
+        , .sourceSize = source.size()
+        , .sourceDigest = DigestSource(source)
+        , .payloadSize = payload.size()
+        , .checksum = HashBytes(payload)
+    };
+
+    std::string image;
+    image.reserve(sizeof(header) + payload.size());
+
+    Writer imageOut(image);
+    imageOut.Put(header);
+    image += payload;
+
+    return image;
+}
+
+std::optional<LoadedProgram> core::LoadProgramImage(std::string_view image, std::uint64_t key, std::string_view source) {
+    try {
+        Reader headerIn(image);
+        const auto header = headerIn.Get<ImageHeader>();
+        const std::string_view payload = image.substr(sizeof(ImageHeader));
+
+        if (header.magic != Magic || header.formatVersion != FormatVersion || header.key != key)
+            return std::nullopt;
+
+        if (header.sourceSize != source.size() || header.sourceDigest != DigestSource(source))
+            return std::nullopt;
+
+        if (header.payloadSize != payload.size() || header.checksum != HashBytes(payload))
+            return std::nullopt;
+
+        Reader in(payload);
+        LoadedProgram loaded;
+
+        const auto symbolCount = in.Get<std::uint32_t>();
+
+        for (std::uint32_t i = 0; i < symbolCount; i++) {
+            // Duplicate names would shift the symbols after them
+            if (loaded.symbols.Intern(in.GetBytes()) != i)
+                return std::nullopt;
+        }
+
+        loaded.statements = in.Get<StatementList>();
+
+        ForEachPlainPool(loaded.program, [&](auto& pool) {
+            in.GetArray(pool);
+        });
+
+        for (const Symbol symbol : loaded.program.symbolLists) {
+            loaded.program.MarkLocal(symbol);
+        }
+
+        const auto literalCount = in.Get<std::uint32_t>();
+        loaded.program.literalExprs.reserve(literalCount);
+
+        for (std::uint32_t i = 0; i < literalCount; i++) {
+            loaded.program.literalExprs.emplace_back(GetValue(in, loaded.symbols));
+        }
+
+        const StatementList top = loaded.statements;
+
+        if (not in.AtEnd() || top.first + std::uint64_t(top.count) > loaded.program.stmtLists.size())
+            return std::nullopt;
+
+        if (not IsInBounds(loaded.program, loaded.symbols.Size(), source.size()))
+            return std::nullopt;
+
+        if (not TreeChecker(loaded.program).CheckStatements(top))
+            return std::nullopt;
+
+        return loaded;
+    } catch (const CorruptImage&) {
+        return std::nullopt;
+    }
+}
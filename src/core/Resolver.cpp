@@ -0,0 +1,220 @@
+#include <limits>
+#include <optional>
+#include "core/Resolver.hpp"
+
+using namespace dxsh;
+using namespace core;
+
+namespace {
+    struct Scope {
+        std::vector<Symbol> slots; // Declared so far, in order
+        bool isFunction{};
+
+        // Later declarations of a name win, such as a repeated parameter
+        std::optional<std::uint32_t> Find(Symbol symbol) const {
+            for (std::size_t i = slots.size(); i-- > 0;) {
+                if (slots[i] == symbol)
+                    return static_cast<std::uint32_t>(i);
+            }
+
+            return std::nullopt;
+        }
+    };
+
+    class Resolver {
+        Program& program;
+
+        // Enclosing scopes, innermost last. Empty in the global scope.
+        std::vector<Scope> scopes;
+
+        public:
+        explicit Resolver(Program& program) : program(program) { }
+
+        void ResolveStatements(StatementList statements) {
+            for (std::uint32_t i = 0; i < statements.count; i++) {
+                ResolveStatement(program.stmtLists[statements.first + i]);
+            }
+        }
+
+        void ResolveFunction(std::uint32_t func);
+
+        private:
+        void ResolveStatement(StmtId stmt);
+        void ResolveExpr(ExprId expr);
+
+        Binding Declare(Symbol symbol);
+        Binding Resolve(Symbol symbol) const;
+
+        // Ends the innermost scope, storing its slots in the program
+        IndexRange<Symbol> PopScope() {
+            const IndexRange<Symbol> slots = program.AddList(std::span<const Symbol>(scopes.back().slots));
+            scopes.pop_back();
+            return slots;
+        }
+    };
+}
+
+Binding Resolver::Declare(Symbol symbol) {
+    if (scopes.empty())
+        return { .kind = Binding::Kind::Global };
+
+    Scope& scope = scopes.back();
+    std::optional<std::uint32_t> slot = scope.Find(symbol);
+
+    if (not slot) {
+        slot = static_cast<std::uint32_t>(scope.slots.size());
+        scope.slots.push_back(symbol);
+    }
+
+    return { .kind = Binding::Kind::Local, .slot = *slot };
+}
+
+Binding Resolver::Resolve(Symbol symbol) const {
+    bool inFunction = true;
+
+    for (std::size_t i = scopes.size(); i-- > 0;) {
+        const Scope& scope = scopes[i];
+
+        if (auto slot = scope.Find(symbol)) {
+            const std::size_t hops = scopes.size() - 1 - i;
+
+            if (not inFunction || hops > std::numeric_limits<std::uint16_t>::max())
+                return { .kind = Binding::Kind::Dynamic };
+
+            return {
+                  .kind = Binding::Kind::Local
+                , .hops = static_cast<std::uint16_t>(hops)
+                , .slot = *slot
+            };
+        }
+
+        // Scopes past a function's own belong to whichever scope calls it
+        if (scope.isFunction)
+            inFunction = false;
+    }
+
+    // A caller of the function may declare the name, which then shadows any
+    // global, so only names outside every function go straight to the globals
+    return { .kind = inFunction ? Binding::Kind::Global : Binding::Kind::Dynamic };
+}
+
+void Resolver::ResolveFunction(std::uint32_t func) {
+    const FuncStatement node = program.funcStmts[func];
+
+    // Deferred bodies are resolved once they are parsed
+    if (not node.IsParsed())
+        return;
+
+    const auto params = program.Get(node.params);
+    scopes.push_back(Scope{ .slots = { params.begin(), params.end() }, .isFunction = true });
+
+    ResolveStatements(node.statements);
+
+    program.funcStmts[func].slots = PopScope();
+}
+
+void Resolver::ResolveStatement(StmtId stmt) {
+    using enum StmtKind;
+
+    const std::uint32_t index = stmt.Index();
+
+    switch (stmt.GetKind()) {
+        case Expr:
+            ResolveExpr(program.exprStmts[index].expr);
+            break;
+        case Print:
+            ResolveExpr(program.printStmts[index].expr);
+            break;
+        case VarDecl: {
+            // The value is evaluated before the variable exists, so any use of
+            // the name in it refers further out
+            ResolveExpr(program.varDeclStmts[index].value);
+
+            VarDeclStatement& node = program.varDeclStmts[index];
+            node.binding = Declare(node.symbol);
+            break;
+        }
+        case Block:
+            scopes.push_back(Scope{});
+            ResolveStatements(program.blockStmts[index].statements);
+            program.blockStmts[index].slots = PopScope();
+            break;
+        case If: {
+            // Branches without braces declare into the enclosing scope
+            const IfStatement node = program.ifStmts[index];
+            ResolveExpr(node.condition);
+            ResolveStatement(node.yesBranch);
+
+            if (node.noBranch)
+                ResolveStatement(node.noBranch);
+
+            break;
+        }
+        case Func: {
+            // Declared before the body is resolved, so it can call itself
+            FuncStatement& node = program.funcStmts[index];
+            node.binding = Declare(node.name);
+
+            ResolveFunction(index);
+            break;
+        }
+        case Return:
+            if (const ExprId expr = program.returnStmts[index].expr)
+                ResolveExpr(expr);
+
+            break;
+    }
+}
+
+void Resolver::ResolveExpr(ExprId expr) {
+    using enum ExprKind;
+
+    const std::uint32_t index = expr.Index();
+
+    switch (expr.GetKind()) {
+        case Binary:
+            ResolveExpr(program.binaryExprs[index].left);
+            ResolveExpr(program.binaryExprs[index].right);
+            break;
+        case Unary:
+            ResolveExpr(program.unaryExprs[index].operand);
+            break;
+        case Grouping:
+            ResolveExpr(program.groupingExprs[index].expr);
+            break;
+        case Literal: {
+            Value& value = program.literalExprs[index].value;
+
+            if (value.GetType() == ValueType::Lvalue) {
+                Lvalue lvalue = value.GetAs<Lvalue>();
+                lvalue.binding = Resolve(lvalue.symbol);
+                value = lvalue;
+            }
+
+            break;
+        }
+        case Assignment:
+            ResolveExpr(program.assignmentExprs[index].target);
+            ResolveExpr(program.assignmentExprs[index].value);
+            break;
+        case Call: {
+            ResolveExpr(program.callExprs[index].function);
+
+            const ExprList args = program.callExprs[index].args;
+
+            for (std::uint32_t i = 0; i < args.count; i++) {
+                ResolveExpr(program.exprLists[args.first + i]);
+            }
+
+            break;
+        }
+    }
+}
+
+void core::ResolveScopes(Program& program, StatementList statements) {
+    Resolver(program).ResolveStatements(statements);
+}
+
+void core::ResolveFunctionBody(Program& program, std::uint32_t func) {
+    Resolver(program).ResolveFunction(func);
+}
@@ -0,0 +1,240 @@
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#include "core/Scanner.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define DXSH_SCANNER_X86_64
+    #include <immintrin.h>
+
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define DXSH_TARGET_AVX2
+    #else
+        #include <cpuid.h>
+        #define DXSH_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#endif
+
+using namespace dxsh;
+using namespace core;
+using namespace Scanner;
+
+// Each scan operation defines which characters stop it, both one at a time
+// and as a bitmask over a vector of characters
+struct SkipWhitespaceOp {
+    static bool Stops(char c) { return not IsWhitespace(c); }
+
+#ifdef DXSH_SCANNER_X86_64
+    static unsigned StopMask(__m128i v) {
+        __m128i ws = _mm_or_si128(
+              _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),  _mm_cmpeq_epi8(v, _mm_set1_epi8('\t')))
+            , _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\r')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\n')))
+        );
+
+        return ~static_cast<unsigned>(_mm_movemask_epi8(ws)) & 0xFFFF;
+    }
+
+    DXSH_TARGET_AVX2 static unsigned StopMask(__m256i v) {
+        __m256i ws = _mm256_or_si256(
+              _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')),  _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\t')))
+            , _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\r')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')))
+        );
+
+        return ~static_cast<unsigned>(_mm256_movemask_epi8(ws));
+    }
+#endif
+};
+
+struct SkipIdentifierOp {
+    static bool Stops(char c) { return not IsAlphanumeric(c); }
+
+#ifdef DXSH_SCANNER_X86_64
+    // Signed byte compares, so non-ASCII bytes fall outside every range
+    static unsigned StopMask(__m128i v) {
+        __m128i folded = _mm_or_si128(v, _mm_set1_epi8(0x20)); // Lowercases letters
+        __m128i alpha  = _mm_and_si128(_mm_cmpgt_epi8(folded, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(folded, _mm_set1_epi8('z' + 1)));
+        __m128i digit  = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1)));
+        __m128i ident  = _mm_or_si128(_mm_or_si128(alpha, digit), _mm_cmpeq_epi8(v, _mm_set1_epi8('_')));
+
+        return ~static_cast<unsigned>(_mm_movemask_epi8(ident)) & 0xFFFF;
+    }
+
+    DXSH_TARGET_AVX2 static unsigned StopMask(__m256i v) {
+        __m256i folded = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+        __m256i alpha  = _mm256_and_si256(_mm256_cmpgt_epi8(folded, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), folded));
+        __m256i digit  = _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), v));
+        __m256i ident  = _mm256_or_si256(_mm256_or_si256(alpha, digit), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('_')));
+
+        return ~static_cast<unsigned>(_mm256_movemask_epi8(ident));
+    }
+#endif
+};
+
+template<char... Targets>
+struct FindAnyOp {
+    static bool Stops(char c) { return ((c == Targets) || ...); }
+
+#ifdef DXSH_SCANNER_X86_64
+    static unsigned StopMask(__m128i v) {
+        __m128i matches = _mm_setzero_si128();
+        ((matches = _mm_or_si128(matches, _mm_cmpeq_epi8(v, _mm_set1_epi8(Targets)))), ...);
+
+        return static_cast<unsigned>(_mm_movemask_epi8(matches));
+    }
+
+    DXSH_TARGET_AVX2 static unsigned StopMask(__m256i v) {
+        __m256i matches = _mm256_setzero_si256();
+        ((matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(Targets)))), ...);
+
+        return static_cast<unsigned>(_mm256_movemask_epi8(matches));
+    }
+#endif
+};
+
+using FindQuoteOp        = FindAnyOp<'"'>;
+using FindNewlineOp      = FindAnyOp<'\n'>;
+using FindQuoteOrSlashOp = FindAnyOp<'"', '/'>;
+
+template<typename Op>
+static std::size_t ScanScalar(const char* data, std::size_t pos, std::size_t size) {
+    while (pos < size && not Op::Stops(data[pos])) {
+        pos++;
+    }
+
+    return pos;
+}
+
+#ifdef DXSH_SCANNER_X86_64
+template<typename Op>
+static std::size_t ScanSse2(const char* data, std::size_t pos, std::size_t size) {
+    while (pos + 16 <= size) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        unsigned mask = Op::StopMask(v);
+
+        if (mask != 0)
+            return pos + std::countr_zero(mask);
+
+        pos += 16;
+    }
+
+    return ScanScalar<Op>(data, pos, size);
+}
+
+template<typename Op>
+DXSH_TARGET_AVX2 static std::size_t ScanAvx2(const char* data, std::size_t pos, std::size_t size) {
+    while (pos + 32 <= size) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+        unsigned mask = Op::StopMask(v);
+
+        if (mask != 0)
+            return pos + std::countr_zero(mask);
+
+        pos += 32;
+    }
+
+    return ScanScalar<Op>(data, pos, size);
+}
+#endif
+
+using Kernel = std::size_t (*)(const char* data, std::size_t pos, std::size_t size);
+
+struct Kernels {
+    Kernel skipWhitespace;
+    Kernel skipIdentifier;
+    Kernel findQuote;
+    Kernel findNewline;
+    Kernel findQuoteOrSlash;
+};
+
+static Kernels KernelsFor(InstructionSet set) {
+    switch (set) {
+#ifdef DXSH_SCANNER_X86_64
+        case InstructionSet::AVX2:
+            return Kernels{ &ScanAvx2<SkipWhitespaceOp>, &ScanAvx2<SkipIdentifierOp>, &ScanAvx2<FindQuoteOp>, &ScanAvx2<FindNewlineOp>, &ScanAvx2<FindQuoteOrSlashOp> };
+        case InstructionSet::SSE2:
+            return Kernels{ &ScanSse2<SkipWhitespaceOp>, &ScanSse2<SkipIdentifierOp>, &ScanSse2<FindQuoteOp>, &ScanSse2<FindNewlineOp>, &ScanSse2<FindQuoteOrSlashOp> };
+#endif
+        default:
+            return Kernels{ &ScanScalar<SkipWhitespaceOp>, &ScanScalar<SkipIdentifierOp>, &ScanScalar<FindQuoteOp>, &ScanScalar<FindNewlineOp>, &ScanScalar<FindQuoteOrSlashOp> };
+    }
+}
+
+static InstructionSet DetectInstructionSet() {
+#ifdef DXSH_SCANNER_X86_64
+    unsigned regs[4]{}; // eax, ebx, ecx, edx
+
+    auto cpuid = [&regs](unsigned leaf) {
+    #if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuidex(info, static_cast<int>(leaf), 0);
+        std::memcpy(regs, info, sizeof(regs));
+    #else
+        __cpuid_count(leaf, 0, regs[0], regs[1], regs[2], regs[3]);
+    #endif
+    };
+
+    auto xgetbv = []() -> std::uint64_t {
+    #if defined(_MSC_VER) && !defined(__clang__)
+        return _xgetbv(0);
+    #else
+        unsigned eax, edx;
+        __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+        return (static_cast<std::uint64_t>(edx) << 32) | eax;
+    #endif
+    };
+
+    // SSE2 is part of x86-64. AVX2 needs CPU support, and the OS saving YMM state
+    cpuid(0);
+    unsigned maxLeaf = regs[0];
+
+    cpuid(1);
+    bool osxsave = regs[2] & (1u << 27);
+    bool avx     = regs[2] & (1u << 28);
+
+    if (maxLeaf >= 7 && osxsave && avx && (xgetbv() & 0x6) == 0x6) {
+        cpuid(7);
+
+        if (regs[1] & (1u << 5))
+            return InstructionSet::AVX2;
+    }
+
+    return InstructionSet::SSE2;
+#else
+    return InstructionSet::Scalar;
+#endif
+}
+
+static const InstructionSet supportedSet = DetectInstructionSet();
+static InstructionSet currentSet = supportedSet;
+static Kernels kernels = KernelsFor(supportedSet);
+
+std::size_t Scanner::SkipWhitespace(std::string_view source, std::size_t pos) {
+    return kernels.skipWhitespace(source.data(), pos, source.size());
+}
+
+std::size_t Scanner::SkipIdentifier(std::string_view source, std::size_t pos) {
+    return kernels.skipIdentifier(source.data(), pos, source.size());
+}
+
+std::size_t Scanner::FindQuote(std::string_view source, std::size_t pos) {
+    return kernels.findQuote(source.data(), pos, source.size());
+}
+
+std::size_t Scanner::FindNewline(std::string_view source, std::size_t pos) {
+    return kernels.findNewline(source.data(), pos, source.size());
+}
+
+std::size_t Scanner::FindQuoteOrSlash(std::string_view source, std::size_t pos) {
+    return kernels.findQuoteOrSlash(source.data(), pos, source.size());
+}
+
+InstructionSet Scanner::GetInstructionSet() {
+    return currentSet;
+}
+
+void Scanner::SetInstructionSet(InstructionSet set) {
+    currentSet = std::min(set, supportedSet);
+    kernels = KernelsFor(currentSet);
+}
@@ -0,0 +1,29 @@
+#include <algorithm>
+#include <cstring>
+
+#include "core/SourceBuffer.hpp"
+
+using namespace dxsh;
+using namespace core;
+
+std::string_view SourceArena::Retain(std::string_view source) {
+    if (source.empty())
+        return {};
+
+    if (source.size() > remaining) {
+        // Oversized sources get a chunk of their own
+        std::size_t size = std::max(ChunkSize, source.size());
+
+        chunks.push_back(std::make_unique<char[]>(size));
+        cur = chunks.back().get();
+        remaining = size;
+    }
+
+    char* start = cur;
+    std::memcpy(start, source.data(), source.size());
+
+    cur += source.size();
+    remaining -= source.size();
+
+    return std::string_view(start, source.size());
+}
@@ -1,9 +1,8 @@
-#include <ranges>
 #include "magic_enum/magic_enum.hpp"
 
 #include "core/Interpreter.hpp"
+#include "core/Program.hpp"
 #include "core/Statement.hpp"
-#include "core/AstMethods/Evaluate.hpp"
 
 using namespace std::string_literals;
 using namespace std::string_view_literals;
@@ -11,61 +10,67 @@ using namespace std::string_view_literals;
 using namespace dxsh;
 using namespace core;
 
-register_classes(
-      Statement
-    , ExprStatement
-    , PrintStatement
-    , VarDeclStatement
-    , BlockStatement
-    , IfStatement
-    , FuncStatement
-    , ReturnStatement
-);
-
-declare_method(StatementEffect, EvaluateStatement, (virtual_<const Statement&>, Interpreter*));
-
-define_method(StatementEffect, EvaluateStatement, (const ExprStatement& stmt, Interpreter* interpreter)) {
-    AstMethods::Evaluate(*stmt.expr, *interpreter);
+static StatementEffect EvaluateStatement(ExprStatement stmt, const Step& step, Interpreter* interpreter) {
+    if (step.stage == 0 && not interpreter->Then(stmt.expr))
+        return StatementEffect::None;
+
+    interpreter->PopOperand();
+    interpreter->Finish();
+
     return StatementEffect::None;
 }
 
-define_method(StatementEffect, EvaluateStatement, (const VarDeclStatement& stmt, Interpreter* interpreter)) {
-    Value res = AstMethods::Evaluate(*stmt.value, *interpreter);
-    res = interpreter->GetCurEnvironment().ExtractFromLV(res);
+static StatementEffect EvaluateStatement(VarDeclStatement stmt, const Step& step, Interpreter* interpreter) {
+    if (step.stage == 0 && not interpreter->Then(stmt.value))
+        return StatementEffect::None;
+
+    const Value res = interpreter->GetCurEnvironment().ExtractFromLV(interpreter->PopOperand());
 
     interpreter->GetCurEnvironment().CreateOrAssignVar(
-          stmt.identifier.GetRepresentation()
+          stmt.binding
+        , stmt.symbol
         , res
-        , stmt.line
+        , interpreter->GetProgram().GetLine(step.stmt)
     );
 
+    interpreter->Finish();
     return StatementEffect::None;
 }
 
-define_method(StatementEffect, EvaluateStatement, (const PrintStatement& stmt, Interpreter* interpreter)) {
-    Value res = AstMethods::Evaluate(*stmt.expr, *interpreter);
-    res = interpreter->GetCurEnvironment().ExtractFromLV(res);
+static StatementEffect EvaluateStatement(PrintStatement stmt, const Step& step, Interpreter* interpreter) {
+    if (step.stage == 0 && not interpreter->Then(stmt.expr))
+        return StatementEffect::None;
+
+    const Value res = interpreter->GetCurEnvironment().ExtractFromLV(interpreter->PopOperand());
 
     interpreter->GiveOutput(res.ToString());
     interpreter->GiveOutput("\n");
 
+    interpreter->Finish();
     return StatementEffect::None;
 }
 
-define_method(StatementEffect, EvaluateStatement, (const BlockStatement& block, Interpreter* interpreter)) {
-    interpreter->PushContext(ContextType::Scope, block.statements);
-    interpreter->RunInterface();
-    
+// Statements of the block run in its own context, after which it is finished
+static StatementEffect EvaluateStatement(BlockStatement block, const Step& step, Interpreter* interpreter) {
+    if (step.stage == 0) {
+        interpreter->Advance();
+        interpreter->PushContext(ContextType::Scope, block.statements, block.slots.size(), interpreter->GetProgram().GetLine(step.stmt));
+        return StatementEffect::EnterContext;
+    }
+
+    interpreter->Finish();
     return StatementEffect::None;
 }
 
-define_method(StatementEffect, EvaluateStatement, (const IfStatement& stmt, Interpreter* interpreter)) {
-    Value res = AstMethods::Evaluate(*stmt.condition, *interpreter);
-    res = interpreter->GetCurEnvironment().ExtractFromLV(res);
+static StatementEffect EvaluateStatement(IfStatement stmt, const Step& step, Interpreter* interpreter) {
+    if (step.stage == 0 && not interpreter->Then(stmt.condition))
+        return StatementEffect::None;
+
+    const Value res = interpreter->GetCurEnvironment().ExtractFromLV(interpreter->PopOperand());
 
     if (auto type = res.GetType(); type != ValueType::Boolean) {
         throw Error{
-              .line = stmt.tokenIf.line
+              .line = interpreter->GetProgram().GetLine(step.stmt)
             , .message = std::format(
                   "Expected boolean for if condition, got {} instead"
                 , magic_enum::enum_name(type)
@@ -73,63 +78,78 @@ define_method(StatementEffect, EvaluateStatement, (const IfStatement& stmt, Inte
         };
     }
 
+    // The branch runs in place of the if, so its effect is the if's
     if (res.IsTrue()) {
-        return core::EvaluateStatement(*stmt.yesBranch, *interpreter);
-    } else if (stmt.noBranch != nullptr) {
-        return core::EvaluateStatement(*stmt.noBranch, *interpreter);
+        interpreter->Replace(stmt.yesBranch);
+    } else if (stmt.noBranch) {
+        interpreter->Replace(stmt.noBranch);
+    } else {
+        interpreter->Finish();
     }
 
     return StatementEffect::None;
 }
 
-define_method(StatementEffect, EvaluateStatement, (const FuncStatement& func, Interpreter* interpreter)) {
-    // interpreter->GiveOutput("\nFunc name: " + std::string(func.tokenName.GetRepresentation()));
-    // interpreter->GiveOutput("\nParams: ");
-
-    // for (const Token& param : func.params) {
-    //     interpreter->GiveOutput(param.GetRepresentation());
-    //     interpreter->GiveOutput(", ");
-    // }
-
-    // interpreter->GiveOutput("\nStatements: " + std::to_string(func.statements.size()) + "\n");
-
+static StatementEffect EvaluateStatement(FuncStatement func, const Step& step, Interpreter* interpreter) {
     auto funcValue = Function{
-          .line = func.tokenFunc.line
-        , .name = func.tokenName.GetRepresentation()
-        , .params = {}
-        , .statements = func.statements
+          .line = interpreter->GetProgram().GetLine(step.stmt)
+        , .name = interpreter->symbols.GetName(func.name)
+        , .params = func.params
+        , .definition = step.stmt.Index()
     };
 
-    std::ranges::copy(
-          func.params | std::views::transform(&Token::GetRepresentation)
-        , std::back_inserter(funcValue.params)
-    );
-
-    interpreter->GetCurEnvironment().CreateOrAssignVar(funcValue.name, funcValue, funcValue.line);
+    interpreter->GetCurEnvironment().CreateOrAssignVar(func.binding, func.name, funcValue, funcValue.line);
+    interpreter->Finish();
 
     return StatementEffect::None;
 }
 
-define_method(StatementEffect, EvaluateStatement, (const ReturnStatement& stmt, Interpreter* interpreter)) {
+static StatementEffect EvaluateStatement(ReturnStatement stmt, const Step& step, Interpreter* interpreter) {
+    if (stmt.expr && step.stage == 0) {
+        ExprId inner = stmt.expr;
+
+        while (inner.GetKind() == ExprKind::Grouping) {
+            inner = interpreter->GetProgram().groupingExprs[inner.Index()].expr;
+        }
+
+        // A call returned as is may be made in place of this function
+        const bool tail = inner.GetKind() == ExprKind::Call && interpreter->TailCallsEnabled();
+
+        if (not interpreter->Then(tail ? inner : stmt.expr, tail))
+            return StatementEffect::None;
+    }
+
     Value returnValue;
 
     if (stmt.expr) {
         // Return with value
-        returnValue = AstMethods::Evaluate(*stmt.expr, *interpreter);
-        returnValue = interpreter->GetCurEnvironment().ExtractFromLV(returnValue);
+        returnValue = interpreter->GetCurEnvironment().ExtractFromLV(interpreter->PopOperand());
     }
 
     interpreter->PushReturn(returnValue);
+    interpreter->Finish();
 
     return StatementEffect::ExitFunction;
 }
 
 
-StatementEffect core::EvaluateStatement(const Statement& stmt, Interpreter& interpreter) {
-    try {
-        return ::EvaluateStatement(stmt, &interpreter);
-    } catch (const Error& e) {
-        interpreter.errors.push_back(e);
-        return StatementEffect::None;
+// Nodes are passed by value, since their pools may grow if a call parses the
+// body of a deferred function while the node is evaluated
+StatementEffect core::EvaluateStatement(const Step& step, Interpreter& interpreter) {
+    using enum StmtKind;
+
+    const Program& program = interpreter.GetProgram();
+    const std::uint32_t index = step.stmt.Index();
+
+    switch (step.stmt.GetKind()) {
+        case Expr:    return ::EvaluateStatement(program.exprStmts[index], step, &interpreter);
+        case Print:   return ::EvaluateStatement(program.printStmts[index], step, &interpreter);
+        case VarDecl: return ::EvaluateStatement(program.varDeclStmts[index], step, &interpreter);
+        case Block:   return ::EvaluateStatement(program.blockStmts[index], step, &interpreter);
+        case If:      return ::EvaluateStatement(program.ifStmts[index], step, &interpreter);
+        case Func:    return ::EvaluateStatement(program.funcStmts[index], step, &interpreter);
+        case Return:  return ::EvaluateStatement(program.returnStmts[index], step, &interpreter);
     }
-}
+
+    throw std::runtime_error("Invalid statement kind");
+}
\ No newline at end of file
@@ -0,0 +1,13 @@
+#include "core/Symbols.hpp"
+
+using namespace dxsh;
+using namespace core;
+
+Symbol SymbolTable::Intern(std::string_view name) {
+    auto [it, inserted] = ids.try_emplace(name, static_cast<Symbol>(names.size()));
+
+    if (inserted)
+        names.push_back(name);
+
+    return it->second;
+}
@@ -0,0 +1,171 @@
+#include <algorithm>
+
+#include "core/TokenBuffer.hpp"
+
+using namespace dxsh;
+using namespace core;
+
+void TokenBuffer::Push(TokenType type, std::uint32_t offset, std::uint32_t length) {
+    types.push_back(type);
+    offsets.push_back(offset);
+    lengths.push_back(length);
+}
+
+void TokenBuffer::Push(TokenType type, std::uint32_t offset, std::uint32_t length, Token::Literal literal) {
+    // String literals are recovered from the lexeme in Get, so aren't stored
+    if (not std::holds_alternative<std::string_view>(literal))
+        literals.emplace_back(static_cast<std::uint32_t>(types.size()), literal);
+
+    Push(type, offset, length);
+}
+
+void TokenBuffer::PushIdentifier(std::uint32_t offset, std::uint32_t length, Symbol symbol) {
+    symbols.emplace_back(static_cast<std::uint32_t>(types.size()), symbol);
+    Push(TokenType::Identifier, offset, length);
+}
+
+// Number of tokens appended from part, leaving out its Eof
+static std::size_t AppendedCount(TokenType lastType, std::size_t size) {
+    return size > 0 && lastType == TokenType::Eof ? size - 1 : size;
+}
+
+std::vector<TokenBuffer::Placement> TokenBuffer::Extend(std::span<const TokenBuffer> parts, std::span<const std::size_t> baseOffsets) {
+    std::vector<Placement> placements;
+    placements.reserve(parts.size());
+
+    Placement next{ 0, Size(), lineStarts.size(), literals.size(), symbols.size() };
+
+    for (std::size_t i = 0; i < parts.size(); i++) {
+        const TokenBuffer& part = parts[i];
+        std::size_t count = AppendedCount(part.types.empty() ? TokenType::Eof : part.types.back(), part.Size());
+
+        next.baseOffset = static_cast<std::uint32_t>(baseOffsets[i]);
+        placements.push_back(next);
+
+        next.firstToken += count;
+        next.firstLiteral += std::ranges::lower_bound(part.literals, count, {}, &decltype(literals)::value_type::first) - part.literals.begin();
+        next.firstSymbol += part.symbols.size(); // Eof is never an identifier
+
+        // A part's first line is the line before it ends, already recorded
+        next.firstLine += part.lineStarts.size() - 1;
+    }
+
+    types.resize(next.firstToken);
+    offsets.resize(next.firstToken);
+    lengths.resize(next.firstToken);
+    literals.resize(next.firstLiteral);
+    symbols.resize(next.firstSymbol);
+    lineStarts.resize(next.firstLine);
+
+    return placements;
+}
+
+void TokenBuffer::CopyIn(const TokenBuffer& part, const Placement& placement, std::span<const Symbol> symbolMap) {
+    std::size_t count = AppendedCount(part.types.empty() ? TokenType::Eof : part.types.back(), part.Size());
+
+    std::ranges::copy_n(part.types.begin(), count, types.begin() + placement.firstToken);
+    std::ranges::copy_n(part.lengths.begin(), count, lengths.begin() + placement.firstToken);
+
+    for (std::size_t i = 0; i < count; i++) {
+        offsets[placement.firstToken + i] = part.offsets[i] + placement.baseOffset;
+    }
+
+    for (std::size_t i = 0; i < part.literals.size() && part.literals[i].first < count; i++) {
+        const auto& [index, literal] = part.literals[i];
+        literals[placement.firstLiteral + i] = { static_cast<std::uint32_t>(index + placement.firstToken), literal };
+    }
+
+    for (std::size_t i = 0; i < part.symbols.size(); i++) {
+        const auto [index, symbol] = part.symbols[i];
+        symbols[placement.firstSymbol + i] = { static_cast<std::uint32_t>(index + placement.firstToken), symbolMap[symbol] };
+    }
+
+    for (std::size_t i = 1; i < part.lineStarts.size(); i++) {
+        lineStarts[placement.firstLine + i - 1] = part.lineStarts[i] + placement.baseOffset;
+    }
+}
+
+int TokenBuffer::GetLine(std::size_t index) const {
+    auto it = std::ranges::upper_bound(lineStarts, offsets[index]);
+    return static_cast<int>(it - lineStarts.begin());
+}
+
+std::string_view TokenBuffer::GetLexeme(std::size_t index) const {
+    return source.substr(offsets[index], lengths[index]);
+}
+
+Token TokenBuffer::Get(std::size_t index) const {
+    Token token{
+          .type = types[index]
+        , .line = GetLine(index)
+        , .lexeme = GetLexeme(index)
+    };
+
+    if (token.type == TokenType::String) {
+        // String literals have no escapes, the literal is the lexeme without quotes
+        token.literal = token.lexeme.substr(1, token.lexeme.size() - 2);
+    } else if (token.type == TokenType::Integer || token.type == TokenType::Decimal) {
+        auto it = std::ranges::lower_bound(
+              literals
+            , static_cast<std::uint32_t>(index)
+            , {}
+            , &decltype(literals)::value_type::first
+        );
+
+        token.literal = it->second;
+    } else if (token.type == TokenType::Identifier) {
+        auto it = std::ranges::lower_bound(
+              symbols
+            , static_cast<std::uint32_t>(index)
+            , {}
+            , &decltype(symbols)::value_type::first
+        );
+
+        token.symbol = it->second;
+    }
+
+    return token;
+}
+
+Token TokenBuffer::Get(const Cursor& cursor) const {
+    const std::size_t index = cursor.index;
+
+    Token token{
+          .type = types[index]
+        , .line = static_cast<int>(cursor.line + 1)
+        , .lexeme = GetLexeme(index)
+    };
+
+    if (token.type == TokenType::String) {
+        token.literal = token.lexeme.substr(1, token.lexeme.size() - 2);
+    } else if (cursor.literal < literals.size() && literals[cursor.literal].first == index) {
+        token.literal = literals[cursor.literal].second;
+    } else if (cursor.symbol < symbols.size() && symbols[cursor.symbol].first == index) {
+        token.symbol = symbols[cursor.symbol].second;
+    }
+
+    return token;
+}
+
+TokenBuffer::Cursor TokenBuffer::Begin() const {
+    Cursor cursor;
+    SyncLine(cursor);
+    return cursor;
+}
+
+void TokenBuffer::Advance(Cursor& cursor) const {
+    if (cursor.literal < literals.size() && literals[cursor.literal].first == cursor.index)
+        cursor.literal++;
+
+    if (cursor.symbol < symbols.size() && symbols[cursor.symbol].first == cursor.index)
+        cursor.symbol++;
+
+    cursor.index++;
+    SyncLine(cursor);
+}
+
+void TokenBuffer::SyncLine(Cursor& cursor) const {
+    while (cursor.line + 1 < lineStarts.size() && lineStarts[cursor.line + 1] <= offsets[cursor.index]) {
+        cursor.line++;
+    }
+}
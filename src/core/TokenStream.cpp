@@ -0,0 +1,23 @@
+#include <cassert>
+
+#include "core/TokenStream.hpp"
+
+using namespace dxsh;
+using namespace core;
+
+TokenStream::TokenStream(Lexer& lexer, std::string_view source, int firstLine)
+    : lexer(&lexer), source(source)
+{
+    lexer.Start(source, firstLine);
+}
+
+const Token& TokenStream::Get(std::size_t index) {
+    while (pulled <= index) {
+        ring[pulled % Window] = lexer->Next();
+        pulled++;
+    }
+
+    assert(index + Window >= pulled && "Token already evicted from the stream window");
+
+    return ring[index % Window];
+}
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <iostream>
 #include <magic_enum/magic_enum_container.hpp>
 
@@ -6,23 +9,6 @@
 using namespace dxsh;
 using namespace core;
 
-static std::unordered_map<std::string_view, TokenType> keywordTokenMap = {
-      { "and",      TokenType::And }
-    , { "or",       TokenType::Or }
-    , { "not",      TokenType::Not }
-    , { "print",    TokenType::Print }
-    , { "true",     TokenType::True }
-    , { "false",    TokenType::False }
-    , { "for",      TokenType::For }
-    , { "if",       TokenType::If }
-    , { "else",     TokenType::Else }
-    , { "while",    TokenType::While }
-    , { "func",     TokenType::Function }
-    , { "return",   TokenType::Return }
-    , { "var",      TokenType::Var }
-    , { "null",     TokenType::Null }
-};
-
 static constexpr auto tokenTypeReprs = []() {
     using enum TokenType;
 
@@ -69,6 +55,81 @@ static constexpr auto tokenTypeReprs = []() {
     return reprs;
 }();
 
+// Keywords are spelled by their entry in tokenTypeReprs
+static constexpr std::array keywordTypes = {
+      TokenType::And
+    , TokenType::Or
+    , TokenType::Not
+    , TokenType::Print
+    , TokenType::True
+    , TokenType::False
+    , TokenType::For
+    , TokenType::If
+    , TokenType::Else
+    , TokenType::While
+    , TokenType::Function
+    , TokenType::Return
+    , TokenType::Var
+    , TokenType::Null
+};
+
+static constexpr auto keywordLengths = []() {
+    std::pair<std::size_t, std::size_t> minMax{ SIZE_MAX, 0 };
+
+    for (TokenType type : keywordTypes) {
+        minMax.first  = std::min(minMax.first, tokenTypeReprs[type].size());
+        minMax.second = std::max(minMax.second, tokenTypeReprs[type].size());
+    }
+
+    return minMax;
+}();
+
+// Perfect hash table of keywords, with Identifier marking empty slots.
+// The length, first and last character are enough to tell keywords apart,
+// so only the multiplier for the first character needs to be searched for.
+struct KeywordTable {
+    static constexpr std::size_t Size = 64;
+
+    std::array<TokenType, Size> types{};
+    std::size_t seed{};
+
+    constexpr std::size_t Hash(std::string_view lexeme) const {
+        auto first = static_cast<unsigned char>(lexeme.front());
+        auto last  = static_cast<unsigned char>(lexeme.back());
+
+        return (first * seed + last + lexeme.size()) & (Size - 1);
+    }
+};
+
+static constexpr auto keywordTable = []() {
+    for (std::size_t seed = 1; seed < 1024; seed++) {
+        KeywordTable table{ .seed = seed };
+        table.types.fill(TokenType::Identifier);
+
+        bool collided = false;
+
+        for (TokenType type : keywordTypes) {
+            auto& slot = table.types[table.Hash(tokenTypeReprs[type])];
+
+            if (slot != TokenType::Identifier) {
+                collided = true;
+                break;
+            }
+
+            slot = type;
+        }
+
+        if (not collided)
+            return table;
+    }
+
+    throw "No collision-free keyword hash seed found";
+}();
+
+static_assert(std::ranges::all_of(keywordTypes, [](TokenType type) {
+    return keywordTable.types[keywordTable.Hash(tokenTypeReprs[type])] == type;
+}));
+
 static constexpr auto tokenClasses = []() {
     using enum TokenType;
     using enum TokenClass;
@@ -121,10 +182,14 @@ static constexpr auto tokenClasses = []() {
 }();
 
 TokenType core::GetPotentialKeywordTokenType(std::string_view lexeme) {
-    auto it = keywordTokenMap.find(lexeme);
+    if (lexeme.size() < keywordLengths.first || lexeme.size() > keywordLengths.second)
+        return TokenType::Identifier;
 
-    if (it != keywordTokenMap.end())
-        return it->second;
+    TokenType candidate = keywordTable.types[keywordTable.Hash(lexeme)];
+
+    // Empty slots hold Identifier, whose representation never matches
+    if (tokenTypeReprs[candidate] == lexeme)
+        return candidate;
     else
         return TokenType::Identifier;
 }
@@ -133,6 +198,10 @@ TokenClass core::GetTokenClass(TokenType type) {
     return tokenClasses[type];
 }
 
+std::string_view core::GetTokenRepresentation(TokenType type) {
+    return tokenTypeReprs[type];
+}
+
 std::string_view Token::GetRepresentation() const {
     if (not lexeme.empty()) {
         return lexeme;
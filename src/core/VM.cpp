@@ -0,0 +1,560 @@
+#include <algorithm>
+#include <format>
+#include <stdexcept>
+#include <utility>
+#include <magic_enum/magic_enum.hpp>
+#include "core/Environment.hpp"
+#include "core/Operators.hpp"
+#include "core/VM.hpp"
+
+// Labels as values let each instruction jump straight to the next one's
+// handler, rather than back through a single switch
+#if defined(__GNUC__)
+    #define DXSH_THREADED_DISPATCH 1
+#endif
+
+using namespace dxsh;
+using namespace core;
+
+VM::VM(const Program& program, const SymbolTable& symbols)
+    : program(program)
+    , symbols(symbols)
+{ }
+
+void VM::LoadFunctionParser(std::function<StatementList(std::uint32_t)> parser) {
+    functionParser = std::move(parser);
+}
+
+void VM::LoadInterface(std::function<void(void)> interface) {
+    this->interface = std::move(interface);
+}
+
+std::string VM::TakeOutput() {
+    return std::exchange(output, {});
+}
+
+bool VM::Run(StatementList statements) {
+    const Chunk script = CompileScript(program, statements, symbols);
+
+    // A failed run may leave the slots of its blocks declared
+    stack.clear();
+    slots.clear();
+    frames.clear();
+    yieldCounter.Reset();
+
+    try {
+        return Execute(script);
+    } catch (const Error& e) {
+        errors.push_back(e);
+        return false;
+    }
+}
+
+const Chunk& VM::GetChunk(const Function& function) {
+    if (function.definition >= functions.size())
+        functions.resize(program.funcStmts.size());
+
+    std::unique_ptr<Chunk>& chunk = functions[function.definition];
+
+    if (chunk == nullptr) {
+        if (not program.funcStmts[function.definition].IsParsed()) {
+            if (not functionParser)
+                throw std::runtime_error("Deferred function body with no function parser loaded");
+
+            // Syntax errors in the body are thrown from here, before it runs
+            functionParser(function.definition);
+        }
+
+        chunk = std::make_unique<Chunk>(CompileFunction(program, function.definition, symbols));
+    }
+
+    return *chunk;
+}
+
+auto VM::FindGlobal(Symbol symbol) -> Slot* {
+    if (symbol >= globals.size() || not globals[symbol].declared)
+        return nullptr;
+
+    return &globals[symbol];
+}
+
+auto VM::FindVar(Symbol symbol, std::size_t frame, std::size_t below) -> Slot* {
+    for (std::size_t f = frame + 1; f-- > 0;) {
+        const std::size_t base = frames[f].slotBase;
+
+        // Inner scopes have higher slots, and of repeated parameters the later
+        // one wins
+        for (std::size_t i = below; i-- > base;) {
+            if (slots[i].declared && slots[i].symbol == symbol)
+                return &slots[i];
+        }
+
+        // Functions run in the scope of their caller
+        if (f != 0)
+            below = frames[f - 1].slotBase + frames[f - 1].chunk->slotCount;
+    }
+
+    return FindGlobal(symbol);
+}
+
+auto VM::GetVar(const VarRef& var) -> Slot* {
+    using enum Binding::Kind;
+
+    const Frame& frame = frames.back();
+    const std::size_t top = frame.slotBase + frame.chunk->slotCount;
+
+    switch (var.kind) {
+        case Local: {
+            Slot& slot = slots[frame.slotBase + var.slot];
+
+            if (slot.declared)
+                return &slot;
+
+            // As in an Environment, a declaration that didn't run leaves the
+            // name visible further out
+            return FindVar(var.symbol, frames.size() - 1, frame.slotBase + var.scopeBase);
+        }
+        case Global:
+            return FindGlobal(var.symbol);
+        case Dynamic:
+            if (not program.MayBeLocal(var.symbol))
+                return FindGlobal(var.symbol);
+
+            return FindVar(var.symbol, frames.size() - 1, top);
+    }
+
+    return nullptr;
+}
+
+void VM::CheckStackSize(std::size_t frameCount, std::size_t slotCount, int line) const {
+    const std::size_t size = frameCount * sizeof(Frame)
+        + slotCount * sizeof(Slot)
+        + stack.size() * sizeof(Value);
+
+    if (size > stackLimit)
+        throw Error{ .line = line, .message = "Stack overflow" };
+}
+
+const Chunk& VM::PushFrame(std::uint32_t argc, int line) {
+    const std::size_t calleeIndex = stack.size() - 1 - argc;
+    const Function function = stack[calleeIndex].GetAs<Function>();
+    const Chunk& callee = GetChunk(function);
+
+    const Frame& caller = frames.back();
+    const std::size_t base = caller.slotBase + caller.chunk->slotCount;
+
+    CheckStackSize(frames.size() + 1, base + callee.slotCount, line);
+
+    MoveArguments(function, callee, base, argc);
+    PopTo(calleeIndex);
+
+    frames.push_back({ .chunk = &callee, .pc = 0, .slotBase = base, .stackBase = calleeIndex });
+    return callee;
+}
+
+void VM::MoveArguments(const Function& function, const Chunk& callee, std::size_t base, std::uint32_t argc) {
+    if (slots.size() < base + callee.slotCount)
+        slots.resize(base + callee.slotCount);
+
+    for (std::size_t i = base; i < base + callee.slotCount; i++) {
+        slots[i].declared = false;
+    }
+
+    // Arguments move straight into the parameter slots
+    const auto params = program.Get(function.params);
+    const std::size_t first = stack.size() - argc;
+
+    for (std::uint32_t i = 0; i < argc; i++) {
+        Slot& slot = slots[base + i];
+        slot.value = std::move(stack[first + i]);
+        slot.symbol = params[i];
+        slot.declared = true;
+    }
+}
+
+bool VM::CanReplaceFrame(const Function& function) const {
+    const Frame& frame = frames.back();
+    const auto params = program.Get(function.params);
+
+    for (std::size_t i = frame.slotBase; i < frame.slotBase + frame.chunk->slotCount; i++) {
+        if (slots[i].declared && std::ranges::find(params, slots[i].symbol) == params.end())
+            return false;
+    }
+
+    return true;
+}
+
+// Integer operands are by far the most common, so they skip ApplyBinary when
+// the result is the same
+static bool TryIntegerBinary(int l, int r, TokenType op, Value& result) {
+    using enum TokenType;
+
+    switch (op) {
+        case Plus:         result = l + r; return true;
+        case Minus:        result = l - r; return true;
+        case Star:         result = l * r; return true;
+        case Slash:        result = l / r; return true;
+        case Greater:      result = l > r; return true;
+        case GreaterEqual: result = l >= r; return true;
+        case Less:         result = l < r; return true;
+        case LessEqual:    result = l <= r; return true;
+        case EqualEqual:   result = l == r; return true;
+        case BangEqual:    result = l != r; return true;
+        default:           return false;
+    }
+}
+
+// Operators throw errors without a line, which is filled in once one is thrown
+template<typename Apply>
+static Value AtLine(int line, Apply&& apply) {
+    try {
+        return apply();
+    } catch (Error& e) {
+        e.line = line;
+        throw;
+    }
+}
+
+bool VM::Execute(const Chunk& script) {
+    frames.push_back({ .chunk = &script, .pc = 0, .slotBase = 0, .stackBase = 0 });
+
+    if (slots.size() < script.slotCount)
+        slots.resize(script.slotCount);
+
+    // State of the running frame, reloaded on every call and return
+    const Chunk* chunk = &script;
+    const Instruction* code = chunk->code.data();
+    std::uint32_t pc = 0;
+    std::size_t slotBase = 0;
+
+    Instruction instruction;
+
+    auto lineAt = [&]() { return chunk->lines[pc - 1]; };
+
+    auto enter = [&](const Chunk& next, std::uint32_t nextPc, std::size_t nextBase) {
+        chunk = &next;
+        code = next.code.data();
+        pc = nextPc;
+        slotBase = nextBase;
+    };
+
+    // Hands the output so far to the interface once the slice is used up
+    auto yieldIf = [&](bool sliceIsUp) {
+        if (sliceIsUp && interface) {
+            interface();
+            yieldCounter.Reset();
+        }
+    };
+
+    auto undefined = [](const VarRef& var) {
+        return UndefinedVariableError(var.lineOfRef, var.name);
+    };
+
+#ifdef DXSH_THREADED_DISPATCH
+    static const void* const dispatch[] = {
+        #define DXSH_OPCODE_LABEL(name) &&Op_##name,
+        DXSH_OPCODES(DXSH_OPCODE_LABEL)
+        #undef DXSH_OPCODE_LABEL
+    };
+
+    #define VM_CASE(name) Op_##name:
+    #define VM_NEXT()                                                   \
+        instruction = code[pc++];                                       \
+        goto *dispatch[static_cast<std::size_t>(GetOpCode(instruction))]
+
+    VM_NEXT();
+#else
+    #define VM_CASE(name) case OpCode::name:
+    #define VM_NEXT() continue
+
+    while (true) {
+        instruction = code[pc++];
+
+        switch (GetOpCode(instruction)) {
+#endif
+
+    VM_CASE(Const) {
+        stack.push_back(chunk->constants[GetArg(instruction)]);
+        VM_NEXT();
+    }
+
+    VM_CASE(Pop) {
+        stack.pop_back();
+        VM_NEXT();
+    }
+
+    VM_CASE(LoadLocal) {
+        const VarRef& var = chunk->vars[GetArg(instruction)];
+        const Slot& slot = slots[slotBase + var.slot];
+
+        if (slot.declared) {
+            stack.push_back(slot.value);
+            VM_NEXT();
+        }
+
+        const Slot* found = GetVar(var);
+
+        if (found == nullptr)
+            throw undefined(var);
+
+        stack.push_back(found->value);
+        VM_NEXT();
+    }
+
+    VM_CASE(LoadGlobal) {
+        const VarRef& var = chunk->vars[GetArg(instruction)];
+
+        if (var.symbol < globals.size() && globals[var.symbol].declared) {
+            stack.push_back(globals[var.symbol].value);
+            VM_NEXT();
+        }
+
+        const Slot* found = GetVar(var);
+
+        if (found == nullptr)
+            throw undefined(var);
+
+        stack.push_back(found->value);
+        VM_NEXT();
+    }
+
+    VM_CASE(LoadDynamic) {
+        const VarRef& var = chunk->vars[GetArg(instruction)];
+        const Slot* found = GetVar(var);
+
+        if (found == nullptr)
+            throw undefined(var);
+
+        stack.push_back(found->value);
+        VM_NEXT();
+    }
+
+    VM_CASE(CheckVar) {
+        const VarRef& var = chunk->vars[GetArg(instruction)];
+
+        if (GetVar(var) == nullptr)
+            throw undefined(var);
+
+        VM_NEXT();
+    }
+
+    VM_CASE(Store) {
+        const VarRef& var = chunk->vars[GetArg(instruction)];
+        Slot* found = GetVar(var);
+
+        if (found == nullptr)
+            throw undefined(var);
+
+        found->value = stack.back();
+        VM_NEXT();
+    }
+
+    VM_CASE(DeclareLocal) {
+        const VarRef& var = chunk->vars[GetArg(instruction)];
+        Slot& slot = slots[slotBase + var.slot];
+
+        slot.value = std::move(stack.back());
+        slot.symbol = var.symbol;
+        slot.declared = true;
+
+        stack.pop_back();
+        VM_NEXT();
+    }
+
+    VM_CASE(DeclareGlobal) {
+        const VarRef& var = chunk->vars[GetArg(instruction)];
+
+        if (var.symbol >= globals.size())
+            globals.resize(var.symbol + 1);
+
+        Slot& slot = globals[var.symbol];
+
+        slot.value = std::move(stack.back());
+        slot.symbol = var.symbol;
+        slot.declared = true;
+
+        stack.pop_back();
+        VM_NEXT();
+    }
+
+    VM_CASE(ClearLocals) {
+        const std::size_t first = slotBase + code[pc++];
+
+        for (std::size_t i = 0; i < GetArg(instruction); i++) {
+            slots[first + i].declared = false;
+        }
+
+        VM_NEXT();
+    }
+
+    VM_CASE(Binary) {
+        const auto op = static_cast<TokenType>(GetArg(instruction));
+        Value& left = stack[stack.size() - 2];
+        const Value& right = stack.back();
+
+        if (left.GetType() == ValueType::Integer && right.GetType() == ValueType::Integer
+            && TryIntegerBinary(left.GetAs<int>(), right.GetAs<int>(), op, left)) {
+
+            stack.pop_back();
+            VM_NEXT();
+        }
+
+        left = AtLine(lineAt(), [&]() { return ApplyBinary(left, right, op); });
+        stack.pop_back();
+        VM_NEXT();
+    }
+
+    VM_CASE(Unary) {
+        const auto op = static_cast<TokenType>(GetArg(instruction));
+        Value& operand = stack.back();
+
+        if (op == TokenType::Minus && operand.GetType() == ValueType::Integer) {
+            operand = -1 * operand.GetAs<int>();
+            VM_NEXT();
+        }
+
+        operand = AtLine(lineAt(), [&]() { return ApplyUnary(operand, op); });
+        VM_NEXT();
+    }
+
+    VM_CASE(Jump) {
+        pc = GetArg(instruction);
+        VM_NEXT();
+    }
+
+    VM_CASE(JumpIfFalse) {
+        const Value& condition = stack.back();
+
+        if (condition.GetType() != ValueType::Boolean) {
+            throw Error{
+                  .line = lineAt()
+                , .message = std::format(
+                      "Expected boolean for if condition, got {} instead"
+                    , magic_enum::enum_name(condition.GetType())
+                )
+            };
+        }
+
+        if (not condition.GetAs<bool>())
+            pc = GetArg(instruction);
+
+        stack.pop_back();
+        VM_NEXT();
+    }
+
+    VM_CASE(Print) {
+        output += stack.back().ToString();
+        output += '\n';
+        stack.pop_back();
+
+        yieldIf(yieldCounter.TickOutput());
+        VM_NEXT();
+    }
+
+    VM_CASE(CheckCall) {
+        const Value& callee = stack.back();
+
+        if (callee.GetType() != ValueType::Function) {
+            throw Error{
+                  .line = lineAt()
+                , .message = std::format(
+                      "Attempt to treat {} as function in call expression"
+                    , callee.ToPrettyString()
+                )
+            };
+        }
+
+        const auto& function = callee.GetAs<Function>();
+
+        if (function.Arity() != GetArg(instruction)) {
+            throw Error{
+                  .line = lineAt()
+                , .message = std::format(
+                      "Number of arguments ({}) to function call does not match number of parameters ({})."
+                      "\nNote: Function defined on line {}."
+                    , GetArg(instruction), function.Arity(), function.line
+                )
+            };
+        }
+
+        VM_NEXT();
+    }
+
+    VM_CASE(Call) {
+        yieldIf(yieldCounter.Tick());
+
+        frames.back().pc = pc;
+        const Chunk& callee = PushFrame(GetArg(instruction), lineAt());
+        enter(callee, 0, frames.back().slotBase);
+        VM_NEXT();
+    }
+
+    VM_CASE(TailCall) {
+        yieldIf(yieldCounter.Tick());
+
+        const std::uint32_t argc = GetArg(instruction);
+        const Function function = stack[stack.size() - 1 - argc].GetAs<Function>();
+
+        // Otherwise this is a normal call, and the return after it passes on the result
+        if (not tailCalls || not CanReplaceFrame(function)) {
+            frames.back().pc = pc;
+            const Chunk& callee = PushFrame(argc, lineAt());
+            enter(callee, 0, frames.back().slotBase);
+            VM_NEXT();
+        }
+
+        const Chunk& callee = GetChunk(function);
+        CheckStackSize(frames.size(), slotBase + callee.slotCount, lineAt());
+
+        MoveArguments(function, callee, slotBase, argc);
+        PopTo(frames.back().stackBase);
+
+        frames.back().chunk = &callee;
+        enter(callee, 0, slotBase);
+        VM_NEXT();
+    }
+
+    VM_CASE(Return) {
+        yieldIf(yieldCounter.Tick());
+
+        if (frames.size() == 1)
+            throw Error{ .line = 0, .message = "Returning from top-level not implemented" };
+
+        // The result takes the place of the callee
+        const std::size_t stackBase = frames.back().stackBase;
+
+        if (stack.size() != stackBase + 1) {
+            stack[stackBase] = std::move(stack.back());
+            PopTo(stackBase + 1);
+        }
+
+        frames.pop_back();
+
+        const Frame& caller = frames.back();
+        enter(*caller.chunk, caller.pc, caller.slotBase);
+        VM_NEXT();
+    }
+
+    VM_CASE(AssignError) {
+        throw Error{
+              .line = lineAt()
+            , .message = std::format(
+                  "Expected lvalue for assignment target, got {} instead"
+                , magic_enum::enum_name(stack.back().GetType())
+            )
+        };
+    }
+
+    VM_CASE(Halt) {
+        frames.pop_back();
+        return true;
+    }
+
+#ifndef DXSH_THREADED_DISPATCH
+        }
+    }
+#endif
+
+    #undef VM_CASE
+    #undef VM_NEXT
+}
@@ -1,21 +1,35 @@
 #include <format>
+#include <stdexcept>
 #include <magic_enum/magic_enum_container.hpp>
 #include "core/Value.hpp"
 
 using namespace dxsh;
 using namespace core;
 
+void Value::FreeBox() {
+    switch (type) {
+        case ValueType::String:   delete static_cast<detail::BoxOf<std::string>*>(payload.box); break;
+        case ValueType::Lvalue:   delete static_cast<detail::BoxOf<core::Lvalue>*>(payload.box); break;
+        case ValueType::Function: delete static_cast<detail::BoxOf<core::Function>*>(payload.box); break;
+        default: ;
+    }
+}
+
+void Value::ThrowWrongType() const {
+    throw std::logic_error(std::format("Value accessed as the wrong type, it holds {}", magic_enum::enum_name(type)));
+}
+
 std::string Value::ToString() const {
     using enum ValueType;
 
     switch (GetType()) {
         case Null:       return "null";
-        case Integer:    return std::to_string(std::get<int>(value));
-        case Decimal:    return std::to_string(std::get<float>(value));
-        case String:     return std::get<std::string>(value);
-        case Boolean:    return std::get<bool>(value) ? "true" : "false";
-        case Lvalue:     return std::string(std::get<core::Lvalue>(value).name);
-        case Function:   return std::format("[Function: {}]", std::get<core::Function>(value).name);
+        case Integer:    return std::to_string(GetAs<int>());
+        case Decimal:    return std::to_string(GetAs<float>());
+        case String:     return GetAs<std::string>();
+        case Boolean:    return GetAs<bool>() ? "true" : "false";
+        case Lvalue:     return std::string(GetAs<core::Lvalue>().name);
+        case Function:   return std::format("[Function: {}]", GetAs<core::Function>().name);
     }
 }
 
@@ -1,11 +1,8 @@
 #pragma once
 
-#include <memory>
-#include <any>
 #include <variant>
 
-#include <yorel/yomm2/keywords.hpp>
-
+#include "NodeId.hpp"
 #include "Tokens.hpp"
 #include "Value.hpp"
 
@@ -27,84 +24,67 @@
 
 namespace dxsh {
     namespace core {
-        struct Expr {
-            virtual ~Expr() = default;
-        };
-
-        struct BinaryExpr : Expr {
-            std::unique_ptr<Expr> left, right;
-            Token op;
-
-            BinaryExpr() = default;
-            BinaryExpr(decltype(left)&& left, decltype(right)&& right, Token op)
-                : left(std::move(left)), right(std::move(right)), op(std::move(op))
+        // Nodes live in the typed pools of a Program and refer to their children
+        // by id, so they are plain values that can be copied or relocated freely.
+        // They hold only what evaluation needs. The line of each node is kept in
+        // a side table of the Program, for diagnostics.
+
+        struct BinaryExpr {
+            ExprId left;
+            ExprId right;
+            TokenType op;
+
+            BinaryExpr(ExprId left, ExprId right, TokenType op)
+                : left(left), right(right), op(op)
             { }
         };
 
-        struct UnaryExpr : Expr {
-            std::unique_ptr<Expr> operand;
-            Token op;
+        struct UnaryExpr {
+            ExprId operand;
+            TokenType op;
 
-            UnaryExpr() = default;
-            UnaryExpr(decltype(operand)&& operand, Token op)
-                : operand(std::move(operand)), op(std::move(op))
+            UnaryExpr(ExprId operand, TokenType op)
+                : operand(operand), op(op)
             { }
         };
 
-        struct GroupingExpr : Expr {
-            std::unique_ptr<Expr> expr;
+        struct GroupingExpr {
+            ExprId expr;
 
-            GroupingExpr() = default;
-            GroupingExpr(decltype(expr)&& expr)
-                : expr(std::move(expr))
+            GroupingExpr(ExprId expr)
+                : expr(expr)
             { }
         };
 
-        struct LiteralExpr : Expr {
+        struct LiteralExpr {
             Value value;
-            Token token;
 
-            LiteralExpr(Token token) : token(std::move(token)) { };
-            LiteralExpr(Value value, const Token& token)
-                : value(std::move(value)), token(token)
+            LiteralExpr(Value value)
+                : value(std::move(value))
             { }
 
             ValueType GetType() const { return value.GetType(); };
             std::string ToString() const { return value.ToString(); };
         };
 
-        struct AssignmentExpr : Expr {
-            std::unique_ptr<Expr> target;
-            std::unique_ptr<Expr> value;
-            Token equal;
+        struct AssignmentExpr {
+            ExprId target;
+            ExprId value;
 
-            AssignmentExpr(decltype(target)&& target, decltype(value)&& value, const Token& equal)
-                : target(std::move(target))
-                , value(std::move(value))
-                , equal(equal)
+            AssignmentExpr(ExprId target, ExprId value)
+                : target(target)
+                , value(value)
             { }
         };
 
-        struct CallExpr : Expr {
-            std::unique_ptr<Expr> function;
-            std::vector<std::unique_ptr<Expr>> args;
-            Token parenL;
+        struct CallExpr {
+            ExprId function;
+            ExprList args;
 
-            CallExpr(decltype(function)&& func, decltype(args)&& args, const Token& parenL)
-                : function(std::move(func))
-                , args(std::move(args))
-                , parenL(parenL)
+            CallExpr(ExprId func, ExprList args)
+                : function(func)
+                , args(args)
             { }
         };
-
-        register_classes(
-              Expr
-            , BinaryExpr
-            , UnaryExpr
-            , GroupingExpr
-            , LiteralExpr
-            , AssignmentExpr
-            , CallExpr
-        );
     }
-}
\ No newline at end of file
+}
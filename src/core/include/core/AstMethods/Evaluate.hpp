@@ -1,11 +1,21 @@
 #include "core/AST.hpp"
+#include "core/Statement.hpp"
 
 namespace dxsh {
     namespace core {
         class Interpreter;
 
         namespace AstMethods {
-            Value Evaluate(const Expr& expr, Interpreter& interpreter);
+            // Runs step, an expression of the interpreter's loaded program, until
+            // it has a value or has to evaluate a child. A call in tail position
+            // that can replace the returning function is left pending in the
+            // interpreter instead, to be made once it has returned.
+            void Evaluate(const Step& step, Interpreter& interpreter);
+
+            // Evaluates expr straight to an operand if it is a literal, or an
+            // operator on literals, which can't make calls. Returns false if
+            // it needs steps of its own instead.
+            bool EvaluateInPlace(ExprId expr, Interpreter& interpreter);
         }
     }
-}
\ No newline at end of file
+}
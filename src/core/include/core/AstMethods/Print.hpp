@@ -1,10 +1,10 @@
-#include "core/AST.hpp"
+#include "core/Program.hpp"
 
 namespace dxsh {
     namespace core {
         namespace AstMethods {
-            std::string PrintRPN(const Expr& expr);
-            std::string PrintInfix(const Expr& expr);
+            std::string PrintRPN(const Program& program, ExprId expr);
+            std::string PrintInfix(const Program& program, ExprId expr);
         }
     }
 }
\ No newline at end of file
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "Program.hpp"
+#include "Symbols.hpp"
+#include "Value.hpp"
+
+namespace dxsh {
+    namespace core {
+        // Every instruction, in the order of the VM's dispatch table. Operands
+        // are described as the 24-bit argument packed with the opcode, and any
+        // extra words that follow it.
+        #define DXSH_OPCODES(X)                                                 \
+            X(Const)        /* Push constants[arg] */                           \
+            X(Pop)                                                              \
+            X(LoadLocal)    /* Push the variable of vars[arg], for each kind */ \
+            X(LoadGlobal)                                                       \
+            X(LoadDynamic)                                                      \
+            X(CheckVar)     /* Fail if vars[arg] is undefined */                \
+            X(Store)        /* Assign the top to vars[arg], leaving it */       \
+            X(DeclareLocal) /* Pop into vars[arg] */                            \
+            X(DeclareGlobal)                                                    \
+            X(ClearLocals)  /* Undeclare arg slots from the next word on */     \
+            X(Binary)       /* arg is the TokenType */                          \
+            X(Unary)                                                            \
+            X(Jump)         /* Continue at arg */                               \
+            X(JumpIfFalse)  /* Pop a boolean condition, jump to arg if false */ \
+            X(Print)                                                            \
+            X(CheckCall)    /* Check the top is a function taking arg args */  \
+            X(Call)         /* Call the function under the arg args */          \
+            X(TailCall)     /* Call, in place of the running function */        \
+            X(Return)                                                           \
+            X(AssignError)  /* Fail on assigning to the popped non-lvalue */    \
+            X(Halt)
+
+        enum class OpCode : std::uint8_t {
+            #define DXSH_OPCODE_ENUM(name) name,
+            DXSH_OPCODES(DXSH_OPCODE_ENUM)
+            #undef DXSH_OPCODE_ENUM
+        };
+
+        // Instructions are one 32-bit word, the opcode in the low byte and an
+        // argument in the rest
+        using Instruction = std::uint32_t;
+
+        constexpr std::uint32_t MaxInstructionArg = (1u << 24) - 1;
+
+        constexpr Instruction MakeInstruction(OpCode op, std::uint32_t arg = 0) {
+            return static_cast<std::uint32_t>(op) | arg << 8;
+        }
+
+        constexpr OpCode GetOpCode(Instruction instruction) { return static_cast<OpCode>(instruction & 0xFF); }
+        constexpr std::uint32_t GetArg(Instruction instruction) { return instruction >> 8; }
+
+        // A variable referred to by name in the source
+        struct VarRef {
+            Binding::Kind kind;
+            Symbol symbol;
+
+            // For locals, the slot in the frame of the enclosing function, which
+            // flattens all of its block scopes. Slots below scopeBase belong to
+            // the scopes enclosing the one the variable was bound in.
+            std::uint32_t slot{};
+            std::uint32_t scopeBase{};
+
+            int lineOfRef{};
+            std::string_view name; // Only for messages
+        };
+
+        // Compiled form of the top level of a script, or of a function body
+        struct Chunk {
+            std::vector<Instruction> code;
+            std::vector<int> lines; // Line of every word of code, for errors
+            std::vector<Value> constants;
+            std::vector<VarRef> vars;
+
+            // Slots in a frame of the chunk. Block scopes that never run at the
+            // same time share slots.
+            std::uint32_t slotCount{};
+        };
+
+        // Compiles resolved statements to run in the global scope
+        Chunk CompileScript(const Program& program, StatementList statements, const SymbolTable& symbols);
+
+        // Compiles the body of funcStmts[func], which must be parsed and resolved
+        Chunk CompileFunction(const Program& program, std::uint32_t func, const SymbolTable& symbols);
+    }
+}
@@ -1,20 +1,28 @@
 #pragma once
 
-#include <unordered_map>
+#include <span>
+#include <vector>
 #include "Error.hpp"
 #include "Value.hpp"
 
+namespace dxsh {
+    namespace core {
+        struct Program;
+    }
+}
+
 namespace dxsh {
     namespace core {
         class Environment;
 
         struct VarDecl {
-            std::string name;
+            Symbol symbol;
 
             private:
             Value value{};
             int lineOfDecl{};
             int lineOfLastAssign{};
+            bool declared{}; // Slots exist before their declaration runs
 
             public:
             const Value& GetValue() const { return value; };
@@ -26,34 +34,62 @@ namespace dxsh {
             friend Environment;
         };
 
+        // Variables of one scope, stored as a flat array of slots laid out by the
+        // resolver. The global environment is instead indexed by symbol, and
+        // grows as new symbols are declared.
+        //
+        // Slots of a scope are only allocated once its first variable is
+        // declared, so scopes that declare nothing cost nothing.
         class Environment {
             Environment* parent = nullptr;
-            std::unordered_map<std::string, VarDecl> variables;
+            Environment* globals = nullptr; // Null in the global environment itself
+            const Program* program = nullptr; // Only set in the global environment
+            std::size_t slotCount{};
+            std::vector<VarDecl> slots; // Empty until the first declaration
 
             public:
+            // Makes a global environment
             Environment() = default;
 
-            Environment MakeChild();
+            // Turns this into an empty child scope of parent, with slotCount
+            // slots. Memory from its previous use is kept for the new one.
+            void ResetAsChildOf(Environment& parent, std::size_t slotCount);
+
+            // Sets the running program, on the global environment
+            void SetProgram(const Program& program) { this->program = &program; }
 
             // Returns nullptr if var doesn't exist
-            // VarDecl* GetVar(std::string_view name);
-            VarDecl* GetVar(std::string_view name);
+            VarDecl* GetVar(const Lvalue& lvalue);
             
             // Returns nullptr if var doesn't exist
-            // VarDecl* GetVar(std::string_view name);
-            const VarDecl* GetVar(std::string_view name) const;
+            const VarDecl* GetVar(const Lvalue& lvalue) const;
 
-            // Will assign if var already exists
-            void CreateOrAssignVar(std::string_view name, const Value& value, int line);
+            // Will assign if var already exists. Declarations are always bound to
+            // a slot of this scope, or to a global.
+            void CreateOrAssignVar(const Binding& binding, Symbol symbol, const Value& value, int line);
+
+            // Slots laid out for the scope, whether allocated yet or not
+            std::size_t SlotCount() const { return slotCount; }
+
+            // True if every variable declared so far is named in symbols
+            bool DeclaresOnly(std::span<const Symbol> symbols) const;
 
             // If v is an lvalue, will return its true value retrieved from this environment
             // Else, returns v
             // If variable is not found in this context, throws error without line info
             const Value& ExtractFromLV(const Value& v) const;
+
+            private:
+            bool IsGlobal() const { return globals == nullptr; }
+            Environment& GetGlobals() { return IsGlobal() ? *this : *globals; }
+
+            // Slow path, by name through this and every enclosing environment
+            VarDecl* FindVar(Symbol symbol);
+            VarDecl* FindGlobal(Symbol symbol);
         };
 
         struct UndefinedVariableError : Error {
             UndefinedVariableError(int line, std::string_view name);
         };
     }
-}
\ No newline at end of file
+}
@@ -11,6 +11,7 @@ namespace dxsh {
             , ERROR
             , CLOSE
             , EXIT_FUNCTION
+            , ENTER_CONTEXT
         };
 
         enum class ContextType {
@@ -18,19 +19,32 @@ namespace dxsh {
         };
 
         class ExecutionContext {
-            std::size_t id;
-            std::span<const std::unique_ptr<Statement>> statements;
+            std::size_t id{};
+            StatementList statements;
             std::size_t curPos{};
+            std::size_t stepBase{}; // Interpreter steps below this are of callers
 
             public:
             Environment environment;
             ContextType type{};
 
+            ExecutionContext() = default;
             ExecutionContext(std::size_t id, ContextType type, decltype(statements) statements)
                 : id(id), statements(statements), type(type) { }
 
+            // Starts running statements from the top, leaving the environment to
+            // be reset by the caller
+            void Reset(std::size_t id, ContextType type, decltype(statements) statements, std::size_t stepBase) {
+                this->id = id;
+                this->type = type;
+                this->statements = statements;
+                this->stepBase = stepBase;
+                curPos = 0;
+            }
+
             ExecutionStatus ExecuteOne(Interpreter& interpreter);
             int Id() const { return id; }
+            std::size_t StepBase() const { return stepBase; }
         };
     }
 }
\ No newline at end of file
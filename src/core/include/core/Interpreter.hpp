@@ -1,15 +1,23 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
+#include <optional>
 #include <span>
 #include <sstream>
+#include <deque>
 #include <stack>
+#include <utility>
+#include <vector>
 #include <generator.hpp>
 
 #include "core/Error.hpp"
 #include "core/Environment.hpp"
 #include "core/ExecutionContext.hpp"
+#include "core/Program.hpp"
 #include "core/Statement.hpp"
+#include "core/Symbols.hpp"
+#include "core/YieldBudget.hpp"
 
 namespace dxsh {
     namespace core {
@@ -17,32 +25,150 @@ namespace dxsh {
             RanStatement, ClosedContext, Error
         };
 
+        // A call in return position, made in place of the function returning
+        struct PendingCall {
+            Function function;
+            std::vector<Value> args;
+            int line{}; // Of the call
+        };
+
         class Interpreter {
             std::stringstream input, output;
-            std::stack<ExecutionContext> callstack;
+            const Program* program = nullptr;
+            // Contexts of the running blocks and calls, callstack[0, depth). Popped
+            // contexts stay as a pool for the next pushes to reuse, along with the
+            // memory of their environments. A deque never moves its elements, so
+            // environments can point to their parents.
+            std::deque<ExecutionContext> callstack;
+            std::size_t depth{};
+            std::size_t slotsInUse{}; // By the running contexts
             std::stack<Value> returnValues;
+
+            // Nodes of the running statements, innermost last, and the values of
+            // their evaluated children. A call or block pushes its context over
+            // the step that made it, which picks up again once it is popped.
+            std::vector<Step> steps;
+            std::vector<Value> operands;
+
             std::function<void(void)> interpreterInterface;
-            bool isExitingFunction{};
+            std::function<StatementList(std::uint32_t)> functionParser;
+            YieldCounter yieldCounter;
+            bool printed{}; // Since the last statement was counted
+            std::size_t statementsRun{};
+
+            // Counts the statement just run, returning true once the slice is used up
+            bool CountStatement();
+            std::optional<PendingCall> tailCall;
+            bool tailCalls = true;
+
+            // Bytes that contexts, their slots, steps and operands may take up
+            std::size_t stackLimit = DefaultStackLimit;
+
+            // Top-level variables, carried over between loaded programs
+            Environment globals;
+
+            ExecutionContext& Top() { return callstack[depth - 1]; }
+
+            // Pops contexts up to and including the running function, along with
+            // their steps. Fails at the script context.
+            bool ReturnFromFunction();
 
             public:
+            static constexpr std::size_t DefaultStackLimit = 64 << 20;
+
             ErrorContext errors;
 
-            void LoadProgram(std::span<const std::unique_ptr<Statement>> statements);
+            // Identifiers of every loaded program, which share variables by symbol
+            SymbolTable symbols;
+
+            // Runs statements of program, which must outlive the run and have had
+            // its scopes resolved. Top-level variables of previously loaded
+            // programs remain visible.
+            void LoadProgram(const Program& program, StatementList statements);
             void LoadInterface(std::function<void(void)> interface);
 
+            // Called with the index of a FuncStatement whose body was deferred by
+            // the parser, the first time it is called. It parses the body into
+            // the loaded program and returns it. Pools of the program grow while
+            // it runs, so evaluation must not hold references into them across
+            // a call.
+            void LoadFunctionParser(std::function<StatementList(std::uint32_t)> parser);
+
             void RunInterface();
 
+            // ExecuteTopContext only yields after running budget's worth of
+            // statements, counted as described for YieldCounter. Steps through
+            // statements with output one at a time by default.
+            void SetYieldBudget(YieldBudget budget);
+
             std::generator<RuntimeStatus> ExecuteTopContext();
+
+            // Statements run at every call depth, over every loaded program
+            std::size_t StatementsRun() const { return statementsRun; }
             
-            ExecutionContext& PushContext(ContextType type, std::span<const std::unique_ptr<Statement>> statements);
+            // Pushes that would take the stack past bytes fail with a stack
+            // overflow error, as on the VM
+            void SetStackLimit(std::size_t bytes) { stackLimit = bytes; }
+
+            // slots is the number of variables of the new scope, as laid out by
+            // the resolver. line is the call or block the context is for.
+            ExecutionContext& PushContext(ContextType type, StatementList statements, std::size_t slots = 0, int line = 0);
             void PopContext();
 
+            // Runs steps above base until the statement at base finishes, a
+            // context is pushed or an error is recorded
+            StatementEffect RunSteps(std::size_t base);
+            std::size_t StepCount() const { return steps.size(); }
+
+            // Pushes stmt as the statement the top context runs next
+            void Start(StmtId stmt) { steps.push_back({ .stmt = stmt }); }
+
+            // Evaluates child of the running step before it runs again, in its
+            // next stage. Children that can be evaluated in place are pushed as
+            // operands straight away, in which case this returns true and the
+            // step can go on.
+            bool Then(ExprId child, bool tail = false);
+
+            // Evaluates child in place of the running step, to the same effect
+            void Replace(ExprId child);
+            void Replace(StmtId child);
+
+            // Moves the running step on to its next stage
+            void Advance() { steps.back().stage++; }
+
+            // Ends the running expression with value, or the running statement
+            void Finish(Value value);
+            void Finish() { steps.pop_back(); }
+
+            void PushOperand(Value value) { operands.push_back(std::move(value)); }
+            Value& Operand() { return operands.back(); }
+            Value PopOperand();
+
+            // Last count operands, oldest first, until they are dropped
+            std::span<Value> TopOperands(std::size_t count) { return std::span(operands).last(count); }
+            void DropOperands(std::size_t count) { operands.resize(operands.size() - count); }
+
             // Push a return value into the interpreter's stack, defaults to null
             void PushReturn(Value v = {});
             Value PopReturn();
-            bool IsExitingFunction() const { return isExitingFunction; };
+
+            StatementList GetFunctionBody(const Function& function);
+
+            // Turning tail calls off keeps a context for every call, for debugging
+            void SetTailCalls(bool enabled) { tailCalls = enabled; }
+            bool TailCallsEnabled() const { return tailCalls; }
+
+            // Functions run in the scope of their caller, so the running function
+            // can only be replaced by a call when that can't change what any name
+            // refers to. That is when the parameters of the callee, which are
+            // found first, shadow every variable declared in the function so far.
+            bool CanReplaceFunction(std::span<const Symbol> params) const;
+
+            void SetTailCall(PendingCall call) { tailCall = std::move(call); }
+            std::optional<PendingCall> TakeTailCall() { return std::exchange(tailCall, std::nullopt); }
 
             Environment& GetCurEnvironment();
+            const Program& GetProgram() const { return *program; }
             
 
             void GiveInput(std::string_view input);
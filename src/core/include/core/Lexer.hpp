@@ -1,9 +1,12 @@
 #pragma once
 
+#include <optional>
 #include <string_view>
 
 #include "Tokens.hpp"
+#include "TokenBuffer.hpp"
 #include "Error.hpp"
+#include "Symbols.hpp"
 
 namespace dxsh {
     namespace core {
@@ -11,25 +14,49 @@ namespace dxsh {
             enum class LeadingDecimal { No, Yes };
 
             ErrorContext* errors;
+            SymbolTable* symbols;
 
-            std::vector<Token> tokens;
+            TokenBuffer tokens;
+
+            // Streaming mode hands out one token at a time instead of filling tokens
+            bool streaming{};
+            std::optional<Token> streamed;
 
             std::string_view source;
+            std::size_t tokenStart{};
             std::size_t curPos{};
+            int tokenLine{};
             int curLine{};
 
             public:
-            Lexer(ErrorContext& errors) : errors(&errors) { };
+            // Identifiers are interned into symbols, which must outlive the lexer
+            Lexer(ErrorContext& errors, SymbolTable& symbols) : errors(&errors), symbols(&symbols) { };
+
+            // Tokens hold views into source, so it must outlive them. firstLine
+            // numbers errors for a source that continues an earlier one; the
+            // lines in the returned buffer always count from 1.
+            TokenBuffer Parse(std::string_view source, int firstLine = 1);
 
-            std::vector<Token> Parse(std::string_view source);
+            // Streaming mode: lexes source lazily, one token per call to Next.
+            // Next returns Eof once the source is exhausted. Tokens are numbered
+            // from firstLine.
+            void Start(std::string_view source, int firstLine = 1);
+            Token Next();
 
             private:
             void Scan();
 
+            // Both span from tokenStart to curPos
             // For non-value tokens
             void AddToken(TokenType type);
             // For literal tokens
-            void AddToken(TokenType type, std::string lexeme, decltype(Token::literal) literal);
+            void AddToken(TokenType type, Token::Literal literal);
+            void AddIdentifier(Symbol symbol);
+
+            // Records a line starting at lineStart
+            void NewLine(std::size_t lineStart);
+            // Records every line started by a newline in [from, to)
+            void CountNewlines(std::size_t from, std::size_t to);
 
             char Advance();
             char Peek() const;
@@ -42,6 +69,7 @@ namespace dxsh {
             template<typename T>
             void ParseAndAddNumber(std::string_view str);
 
+            void SkipWhitespace();
             void SkipToNewline();
 
             bool IsAtEnd() const;
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+
+namespace dxsh {
+    namespace core {
+        enum class ExprKind : std::uint8_t {
+            Binary, Unary, Grouping, Literal, Assignment, Call
+        };
+
+        enum class StmtKind : std::uint8_t {
+            Expr, Print, VarDecl, Block, If, Func, Return
+        };
+
+        // 32-bit handle to a node in one of a Program's pools. The kind of node
+        // is kept in the top bits, so it can be dispatched on without loading
+        // the node. A default constructed id refers to no node.
+        template<typename Kind>
+        class NodeId {
+            static constexpr int KindShift = 29;
+            static constexpr std::uint32_t IndexMask = (1u << KindShift) - 1;
+
+            std::uint32_t bits = ~0u;
+
+            public:
+            // Largest number of nodes of one kind in a program
+            static constexpr std::uint32_t MaxIndex = IndexMask;
+
+            NodeId() = default;
+            NodeId(Kind kind, std::uint32_t index)
+                : bits(static_cast<std::uint32_t>(kind) << KindShift | index)
+            { }
+
+            Kind GetKind() const { return static_cast<Kind>(bits >> KindShift); }
+            std::uint32_t Index() const { return bits & IndexMask; }
+
+            explicit operator bool() const { return bits != ~0u; }
+
+            auto operator<=>(const NodeId&) const = default;
+        };
+
+        using ExprId = NodeId<ExprKind>;
+        using StmtId = NodeId<StmtKind>;
+
+        // Range of a list of T in one of a Program's list pools
+        template<typename T>
+        struct IndexRange {
+            std::uint32_t first{};
+            std::uint32_t count{};
+
+            std::size_t size() const { return count; }
+            bool empty() const { return count == 0; }
+
+            auto operator<=>(const IndexRange&) const = default;
+        };
+
+        using ExprList = IndexRange<ExprId>;
+        using StatementList = IndexRange<StmtId>;
+    }
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Tokens.hpp"
+#include "Value.hpp"
+
+namespace dxsh {
+    namespace core {
+        // Operator semantics shared by every evaluator. Operands must already be
+        // extracted from lvalues. Errors are thrown with line 0, since only the
+        // caller knows where the operator came from, and it fills the line in.
+        Value ApplyBinary(const Value& left, const Value& right, TokenType op);
+        Value ApplyUnary(const Value& operand, TokenType op);
+    }
+}
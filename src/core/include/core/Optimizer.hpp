@@ -0,0 +1,16 @@
+#pragma once
+
+#include "Program.hpp"
+
+namespace dxsh {
+    namespace core {
+        // Folds every binary, unary and grouping expression whose operands are
+        // all literals into a single literal, throughout statements and the
+        // function bodies nested in them. Identifiers are never folded.
+        //
+        // Operations that would fail at runtime (type errors, integer division
+        // by zero) are left as they are, so they still fail when and if they
+        // run, with the same error. Folded nodes stay in their pools, unused.
+        void FoldConstants(Program& program, StatementList statements);
+    }
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <string_view>
+
+#include "Error.hpp"
+#include "Symbols.hpp"
+#include "TokenBuffer.hpp"
+
+namespace dxsh {
+    namespace core {
+        // Splits source into chunks at line starts that are outside of string
+        // literals and comments, lexes the chunks on a pool of threads, then
+        // stitches them back together. The tokens, errors and symbols produced
+        // are identical to a serial Lexer::Parse of the whole source.
+        //
+        // Sources too small to give each thread at least minChunkSize bytes are
+        // lexed with fewer threads, down to serially on the calling thread.
+        TokenBuffer LexParallel(
+              std::string_view source
+            , ErrorContext& errors
+            , SymbolTable& symbols
+            , unsigned threads
+            , std::size_t minChunkSize = 1024 * 1024
+        );
+    }
+}
@@ -1,10 +1,14 @@
 #pragma once
 
 #include <concepts>
+#include <cstdint>
 #include <span>
 #include "AST.hpp"
 #include "Error.hpp"
+#include "Program.hpp"
 #include "Statement.hpp"
+#include "TokenBuffer.hpp"
+#include "TokenStream.hpp"
 
 
 // program        → (block)* EOF
@@ -31,6 +35,9 @@
 // arguments      → expression ( "," expression )* ;
 // primary        → INTEGER | DECIMAL | STRING | "true" | "false" | "null" | IDENTIFIER
 //                | "(" expression ")" ;
+//
+// Everything from assignment down to call is parsed by one precedence-climbing
+// loop, with each level above given its own Precedence.
 
 namespace dxsh {
     namespace core {
@@ -45,19 +52,73 @@ namespace dxsh {
             concept IsOptional_c = IsOptional<T>::value;
         }
 
+        // Binding power of the infix and postfix operators, loosest first
+        enum class Precedence : std::uint8_t {
+              None
+            , Assignment // Right associative
+            , Equality
+            , Comparison
+            , Term
+            , Factor
+            , Unary      // Prefix only
+            , Call
+        };
+
         class Parser {
-            using ExprStore = std::unique_ptr<Expr>;
-            using StmtStore = std::unique_ptr<Statement>;
+            using ExprStore = ExprId;
+            using StmtStore = StmtId;
 
             ErrorContext* errors;
+            Program* program;
+
+            // Statements of the blocks being parsed, innermost last. Each block's
+            // statements are moved into the program once it closes.
+            std::vector<StmtStore> scratch;
 
-            std::span<const Token> tokens;
+            // Tokens come from exactly one of these
+            const TokenBuffer* tokens = nullptr;
+            TokenStream* stream = nullptr;
             std::size_t curPos{};
+
+            // Tokens from the buffer are materialized once, as the parser
+            // reaches them
+            TokenBuffer::Cursor cursor;
+            Token current;
+            Token previous;
+
+            // Whole script, which the ranges of deferred function bodies index
+            std::string_view script;
+            bool deferBodies{};
+
+            // Blocks and function bodies around the current token. Only bodies at
+            // the top level are deferred, so that they can be resolved later
+            // without their enclosing scopes.
+            int nesting{};
             
             public:
-            Parser(ErrorContext& errors) : errors(&errors) { }
-
-            auto Parse(std::span<const Token> tokens) -> std::vector<StmtStore>;
+            // Nodes are appended to program, after anything parsed into it before
+            Parser(ErrorContext& errors, Program& program) : errors(&errors), program(&program) { }
+
+            auto Parse(const TokenBuffer& tokens) -> StatementList;
+            // Only ever looks one token behind the current one, so fits the stream's window
+            auto Parse(TokenStream& stream) -> StatementList;
+
+            // Incremental parsing, one top-level statement per call to ParseTopLevel
+            // until IsAtEnd. A statement that fails to parse is recorded in errors
+            // and skipped, and ParseTopLevel returns no statement for it.
+            void Start(TokenStream& stream);
+            auto ParseTopLevel() -> StmtStore;
+
+            // Pre-parse mode: bodies of functions declared at the top level are
+            // skipped by matching braces, and only their source range is recorded.
+            // ParseFunctionBody parses one when its function is first called.
+            void DeferFunctionBodies(bool defer) { deferBodies = defer; }
+
+            // Parses the deferred body of funcStmts[func] from script, the source
+            // the function was pre-parsed from, and stores it in the definition.
+            // Lexing errors were reported by the pre-parse, so only syntax errors
+            // are thrown, the first one found.
+            auto ParseFunctionBody(std::uint32_t func, std::string_view script, SymbolTable& symbols) -> StatementList;
 
             auto Block()       -> StmtStore;
             auto Statement()   -> StmtStore;
@@ -68,21 +129,14 @@ namespace dxsh {
             auto ExprStmt()    -> StmtStore;
             auto ReturnStmt()  -> StmtStore;
             auto Expression()  -> ExprStore;
-            auto Assignment()  -> ExprStore;
-            auto Equality()    -> ExprStore;
-            auto Comparison()  -> ExprStore;
-            auto Term()        -> ExprStore;
-            auto Factor()      -> ExprStore;
-            auto Unary()       -> ExprStore;
-            auto Call()        -> ExprStore;
             auto Arguments()   -> std::vector<ExprStore>;
             auto Primary()     -> ExprStore;
 
-            const Token& Advance();
-            const Token& TryConsume(TokenType type, std::string_view error);
+            Token Advance();
+            Token TryConsume(TokenType type, std::string_view error);
 
-            const Token& Previous() const;
-            const Token& Peek() const;
+            Token Previous() const;
+            Token Peek() const;
             bool Check(TokenType type) const;
             bool IsAtEnd() const;
 
@@ -98,24 +152,22 @@ namespace dxsh {
             }
 
             private:
-            void Synchronize();
+            auto ParseProgram() -> StatementList;
 
-            template<auto NestedExpression>
-            ExprStore ParseBinaryExpression(std::same_as<TokenType> auto... types) {
-                auto expr = (this->*NestedExpression)();
+            // Moves the statements in scratch from first onwards into the program
+            StatementList TakeStatements(std::size_t first);
+            TokenType PeekType() const;
 
-                while (MatchConsume(types...)) {
-                    const auto& op = Previous();
+            void Synchronize();
 
-                    expr = std::make_unique<BinaryExpr>(
-                          std::move(expr)             // Left branch
-                        , (this->*NestedExpression)() // Right branch
-                        , op                          // Operator
-                    );
-                }
+            // Parses an expression whose operators all bind at least as tightly as
+            // minPrecedence
+            auto ParseExpression(Precedence minPrecedence) -> ExprStore;
+            auto Prefix() -> ExprStore;
+            auto FinishCall(ExprStore function) -> ExprStore;
 
-                return expr;
-            }
+            // Skips from just after a function's '{' to just after its '}'
+            SourceRange SkipFunctionBody(const Token& open);
 
             auto ParseList(TokenType delimeter, const auto& elementGen)
             requires requires(const decltype(elementGen)& gen) {
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+#include <magic_enum/magic_enum.hpp>
+
+#include "AST.hpp"
+#include "NodeId.hpp"
+#include "Statement.hpp"
+
+namespace dxsh {
+    namespace core {
+        // Flat form of a parsed program. Every node is stored by type in a
+        // contiguous pool and refers to its children by 32-bit id, and child
+        // lists are index ranges into shared list pools. Nothing holds a pointer
+        // into the pools, so a program can be moved, or grown by parsing more
+        // source into it, without invalidating any node or Function value.
+        //
+        // Source lines are only needed for diagnostics, so they are kept out of
+        // the nodes in a side table parallel to each pool.
+        struct Program {
+            std::vector<BinaryExpr> binaryExprs;
+            std::vector<UnaryExpr> unaryExprs;
+            std::vector<GroupingExpr> groupingExprs;
+            std::vector<LiteralExpr> literalExprs;
+            std::vector<AssignmentExpr> assignmentExprs;
+            std::vector<CallExpr> callExprs;
+
+            std::vector<ExprStatement> exprStmts;
+            std::vector<PrintStatement> printStmts;
+            std::vector<VarDeclStatement> varDeclStmts;
+            std::vector<BlockStatement> blockStmts;
+            std::vector<IfStatement> ifStmts;
+            std::vector<FuncStatement> funcStmts;
+            std::vector<ReturnStatement> returnStmts;
+
+            // Elements of every child list, each list stored contiguously
+            std::vector<ExprId> exprLists;
+            std::vector<StmtId> stmtLists;
+            std::vector<Symbol> symbolLists; // Parameters and scope slots
+
+            // Line of every node, indexed by kind and then by pool index
+            std::array<std::vector<int>, magic_enum::enum_count<ExprKind>()> exprLines;
+            std::array<std::vector<int>, magic_enum::enum_count<StmtKind>()> stmtLines;
+
+            ExprId Add(BinaryExpr node, int line)     { return Push(binaryExprs, ExprKind::Binary, std::move(node), line); }
+            ExprId Add(UnaryExpr node, int line)      { return Push(unaryExprs, ExprKind::Unary, std::move(node), line); }
+            ExprId Add(GroupingExpr node, int line)   { return Push(groupingExprs, ExprKind::Grouping, std::move(node), line); }
+            ExprId Add(LiteralExpr node, int line)    { return Push(literalExprs, ExprKind::Literal, std::move(node), line); }
+            ExprId Add(AssignmentExpr node, int line) { return Push(assignmentExprs, ExprKind::Assignment, std::move(node), line); }
+            ExprId Add(CallExpr node, int line)       { return Push(callExprs, ExprKind::Call, std::move(node), line); }
+
+            StmtId Add(ExprStatement node, int line)    { return Push(exprStmts, StmtKind::Expr, std::move(node), line); }
+            StmtId Add(PrintStatement node, int line)   { return Push(printStmts, StmtKind::Print, std::move(node), line); }
+            StmtId Add(VarDeclStatement node, int line) { return Push(varDeclStmts, StmtKind::VarDecl, std::move(node), line); }
+            StmtId Add(BlockStatement node, int line)   { return Push(blockStmts, StmtKind::Block, std::move(node), line); }
+            StmtId Add(IfStatement node, int line)      { return Push(ifStmts, StmtKind::If, std::move(node), line); }
+            StmtId Add(FuncStatement node, int line)    { return Push(funcStmts, StmtKind::Func, std::move(node), line); }
+            StmtId Add(ReturnStatement node, int line)  { return Push(returnStmts, StmtKind::Return, std::move(node), line); }
+
+            ExprList AddList(std::span<const ExprId> list)      { return Append(exprLists, list); }
+            StatementList AddList(std::span<const StmtId> list) { return Append(stmtLists, list); }
+
+            // Symbol lists are parameters and scope slots, so their symbols may be local
+            IndexRange<Symbol> AddList(std::span<const Symbol> list) {
+                for (const Symbol symbol : list) MarkLocal(symbol);
+                return Append(symbolLists, list);
+            }
+
+            std::span<const ExprId> Get(ExprList list) const          { return Slice(exprLists, list); }
+            std::span<const StmtId> Get(StatementList list) const     { return Slice(stmtLists, list); }
+            std::span<const Symbol> Get(IndexRange<Symbol> list) const { return Slice(symbolLists, list); }
+
+            int GetLine(ExprId expr) const { return exprLines[static_cast<std::size_t>(expr.GetKind())][expr.Index()]; }
+            int GetLine(StmtId stmt) const { return stmtLines[static_cast<std::size_t>(stmt.GetKind())][stmt.Index()]; }
+
+            std::size_t NodeCount() const;
+
+            // Functions run in the scope of their caller, so a name a function
+            // doesn't declare is looked up through its callers. Only names some
+            // function or block declares can be found there, and any other name
+            // can go straight to the globals. Nodes that are rolled back stay
+            // marked, which only costs a slower lookup.
+            bool MayBeLocal(Symbol symbol) const { return symbol < localSymbols.size() && localSymbols[symbol]; }
+
+            void MarkLocal(Symbol symbol) {
+                if (symbol >= localSymbols.size())
+                    localSymbols.resize(symbol + 1);
+
+                localSymbols[symbol] = true;
+            }
+
+            // Size of every pool and table, which the program can be rolled back to.
+            // There are 16 node and list pools, and a line table per node kind.
+            using Checkpoint = std::array<std::size_t, 16 + magic_enum::enum_count<ExprKind>() + magic_enum::enum_count<StmtKind>()>;
+
+            Checkpoint GetCheckpoint() const;
+
+            // Drops every node and list added since checkpoint was taken. Nothing
+            // may refer to them anymore, including Function values.
+            void Rollback(const Checkpoint& checkpoint);
+
+            private:
+            std::vector<bool> localSymbols; // Indexed by symbol
+
+            template<typename Node, typename Kind>
+            NodeId<Kind> Push(std::vector<Node>& pool, Kind kind, Node&& node, int line) {
+                if (pool.size() > NodeId<Kind>::MaxIndex)
+                    throw std::length_error("Too many nodes of one kind in program");
+
+                if constexpr (std::same_as<Kind, ExprKind>)
+                    exprLines[static_cast<std::size_t>(kind)].push_back(line);
+                else
+                    stmtLines[static_cast<std::size_t>(kind)].push_back(line);
+
+                pool.push_back(std::move(node));
+                return { kind, static_cast<std::uint32_t>(pool.size() - 1) };
+            }
+
+            template<typename T>
+            static IndexRange<T> Append(std::vector<T>& pool, std::span<const T> list) {
+                IndexRange<T> range{
+                      .first = static_cast<std::uint32_t>(pool.size())
+                    , .count = static_cast<std::uint32_t>(list.size())
+                };
+
+                pool.insert(pool.end(), list.begin(), list.end());
+                return range;
+            }
+
+            template<typename T>
+            static std::span<const T> Slice(const std::vector<T>& pool, IndexRange<T> list) {
+                return std::span(pool).subspan(list.first, list.count);
+            }
+        };
+    }
+}
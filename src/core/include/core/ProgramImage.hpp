@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "Program.hpp"
+#include "Symbols.hpp"
+
+namespace dxsh {
+    namespace core {
+        // Binary form of a parsed program, for caching. An image holds the node
+        // pools, line tables and lists of a Program byte for byte, the literals,
+        // and the names of the symbol table the program was lexed with. Node
+        // pools are copied back in bulk, since nodes refer to each other by
+        // index and need no fixups.
+        //
+        // Images are only readable by the build of dxsh that wrote them. The key
+        // covers the source, the dxsh version and the layout of every node. Since
+        // a key collision would run another script, images also hold the size
+        // and a second digest of their source. Every index in a loaded image is
+        // checked against its pools and the source, its nodes must form a tree,
+        // and every binding must fit the scopes around it.
+
+        // Key of the image of a program parsed from source, and optimized if
+        // optimized is set
+        std::uint64_t ProgramImageKey(std::string_view source, bool optimized);
+
+        // symbols must be the table the program was lexed with, and source the
+        // script it was parsed from
+        std::string SaveProgramImage(
+              const Program& program
+            , StatementList statements
+            , const SymbolTable& symbols
+            , std::uint64_t key
+            , std::string_view source
+        );
+
+        struct LoadedProgram {
+            Program program;
+            StatementList statements;
+
+            // Dense in the same order as when the image was saved. Names are views
+            // into the image, which must outlive this table and the program.
+            SymbolTable symbols;
+        };
+
+        // Returns nullopt if the image is truncated, corrupt, or not of source
+        std::optional<LoadedProgram> LoadProgramImage(std::string_view image, std::uint64_t key, std::string_view source);
+
+        // Fast non-cryptographic 64-bit hash
+        std::uint64_t HashBytes(std::string_view bytes, std::uint64_t seed = 0);
+    }
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Program.hpp"
+
+namespace dxsh {
+    namespace core {
+        // Binds every identifier in statements to where its variable lives at
+        // runtime, and lays out the slots of every block and function scope.
+        // statements run in the global scope.
+        //
+        // A name declared earlier in the same function, or in a block inside it,
+        // is bound to a (hops, slot) pair. Any other name in a function is looked
+        // up by name at runtime, since functions are called in the scope of their
+        // caller, whose variables shadow the globals and aren't known statically.
+        // Only names outside every function are bound to the global table.
+        //
+        // Deferred function bodies are skipped, and resolved by ResolveFunctionBody
+        // once parsed.
+        void ResolveScopes(Program& program, StatementList statements);
+
+        // Resolves the body of funcStmts[func] after it was parsed on its own.
+        // Only functions declared at the top level are deferred, so the body is
+        // resolved as if directly within the global scope.
+        void ResolveFunctionBody(Program& program, std::uint32_t func);
+    }
+}
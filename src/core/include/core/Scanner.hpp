@@ -0,0 +1,63 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace dxsh {
+    namespace core {
+        // Bulk character scanning for the lexer. Each scan starts at pos and
+        // returns the position of the first character that stops it, or
+        // source.size() if none does. Scans run 32 (AVX2) or 16 (SSE2) bytes
+        // at a time when the CPU supports it, falling back to scalar code.
+        namespace Scanner {
+            enum class InstructionSet { Scalar, SSE2, AVX2 };
+
+            // First character that isn't ' ', '\t', '\r' or '\n'
+            std::size_t SkipWhitespace(std::string_view source, std::size_t pos);
+            // First character that isn't [A-Za-z0-9_]
+            std::size_t SkipIdentifier(std::string_view source, std::size_t pos);
+            // First '"'
+            std::size_t FindQuote(std::string_view source, std::size_t pos);
+            // First '\n'
+            std::size_t FindNewline(std::string_view source, std::size_t pos);
+            // First '"' or '/', where strings or comments may begin
+            std::size_t FindQuoteOrSlash(std::string_view source, std::size_t pos);
+
+            // Best instruction set supported by this CPU, picked on startup
+            InstructionSet GetInstructionSet();
+            // Requests above what the CPU supports are lowered to the best supported set
+            void SetInstructionSet(InstructionSet set);
+
+            namespace detail {
+                enum CharClass : std::uint8_t {
+                      Whitespace = 1 << 0
+                    , Alpha      = 1 << 1 // Includes '_'
+                    , Digit      = 1 << 2
+                };
+
+                inline constexpr auto charClasses = []() {
+                    std::array<std::uint8_t, 256> classes{};
+
+                    for (char c : { ' ', '\t', '\r', '\n' }) classes[c] = Whitespace;
+                    for (int c = 'a'; c <= 'z'; c++) classes[c] = Alpha;
+                    for (int c = 'A'; c <= 'Z'; c++) classes[c] = Alpha;
+                    for (int c = '0'; c <= '9'; c++) classes[c] = Digit;
+                    classes['_'] = Alpha;
+
+                    return classes;
+                }();
+
+                inline bool Is(char c, std::uint8_t charClass) {
+                    return charClasses[static_cast<unsigned char>(c)] & charClass;
+                }
+            }
+
+            // ASCII only, unlike the locale-aware <cctype> functions
+            inline bool IsAlpha(char c)        { return detail::Is(c, detail::Alpha); }
+            inline bool IsDigit(char c)        { return detail::Is(c, detail::Digit); }
+            inline bool IsAlphanumeric(char c) { return detail::Is(c, detail::Alpha | detail::Digit); }
+            inline bool IsWhitespace(char c)   { return detail::Is(c, detail::Whitespace); }
+        }
+    }
+}
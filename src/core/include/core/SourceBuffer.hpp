@@ -0,0 +1,25 @@
+#pragma once
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace dxsh {
+    namespace core {
+        // Owns the text of sources handed to the lexer. Token lexemes, string
+        // literals and lvalue names are views into these buffers, so a
+        // SourceArena must outlive every program lexed from it.
+        class SourceArena {
+            static constexpr std::size_t ChunkSize = 16 * 1024;
+
+            std::vector<std::unique_ptr<char[]>> chunks;
+            char* cur = nullptr;
+            std::size_t remaining{};
+
+            public:
+            // Copies source into the arena, returning a view that stays valid
+            // for the lifetime of the arena
+            std::string_view Retain(std::string_view source);
+        };
+    }
+}
@@ -15,95 +15,103 @@ namespace dxsh {
             , CloseContext  // Used for break statements
             , InputRequired // Used for input statements
             , ExitFunction  // Used for return statements
+            , EnterContext  // Used for calls and blocks, whose statements run next
         };
 
-        struct Statement {
-            using ExprStore = std::unique_ptr<Expr>;
-
-            int line; 
-
-            Statement(int line) : line(line) { }
-
-            virtual ~Statement() = default;
+        // Node that is being evaluated, and the stage it has reached, mostly the
+        // number of its children evaluated so far. Their values wait on the
+        // interpreter's operand stack. Steps are kept on a stack of their own,
+        // rather than the native one, so a call can leave its caller half
+        // evaluated while the body runs.
+        struct Step {
+            ExprId expr;
+            StmtId stmt;  // Set instead of expr for a statement
+            std::uint32_t stage{};
+            bool tail{};  // For a call in return position
         };
 
-        struct ExprStatement : Statement {
-            ExprStore expr;
+        // Like expressions, statements live in the pools of a Program, which
+        // keeps the line each one starts on
+
+        struct ExprStatement {
+            ExprId expr;
 
-            ExprStatement(int line, ExprStore expr) : Statement(line), expr(std::move(expr)) { }
+            ExprStatement(ExprId expr) : expr(expr) { }
         };
 
-        struct PrintStatement : Statement {
-            std::unique_ptr<Expr> expr;
+        struct PrintStatement {
+            ExprId expr;
 
-            PrintStatement(int line, ExprStore expr) : Statement(line), expr(std::move(expr)) { }
+            PrintStatement(ExprId expr) : expr(expr) { }
         };
 
-        struct VarDeclStatement : Statement {
-            Token identifier;
-            std::unique_ptr<Expr> value;
+        struct VarDeclStatement {
+            Symbol symbol;
+            ExprId value;
+            Binding binding; // Set by the resolver
 
-            VarDeclStatement(int line, const Token& id, ExprStore value)
-                : Statement(line), identifier(id), value(std::move(value)) { }
+            VarDeclStatement(Symbol symbol, ExprId value)
+                : symbol(symbol), value(value) { }
         };
         
-        struct BlockStatement : Statement {
-            std::vector<std::unique_ptr<Statement>> statements;
-            Token open, close;
+        struct BlockStatement {
+            StatementList statements;
+            IndexRange<Symbol> slots; // Variables declared in the block, set by the resolver
 
-            BlockStatement(const Token& open, const Token& close, decltype(statements)&& statements)
-                : Statement(open.line), statements(std::move(statements)), open(open), close(close) { }
+            BlockStatement(StatementList statements)
+                : statements(statements) { }
         };
 
-        struct IfStatement : Statement {
-            std::unique_ptr<Expr> condition;
-            std::unique_ptr<Statement> yesBranch, noBranch;
-            Token tokenIf, tokenElse;
-
-            IfStatement(
-                  const Token& tokenIf
-                , const Token& tokenElse
-                , decltype(condition)&& condition
-                , decltype(yesBranch)&& yesBranch
-                , decltype(noBranch)&&  noBranch
-            )   
-                : Statement(tokenIf.line)
-                , condition(std::move(condition))
-                , yesBranch(std::move(yesBranch))
-                , noBranch(std::move(noBranch))
-                , tokenIf(tokenIf)
-                , tokenElse(tokenElse)
+        struct IfStatement {
+            ExprId condition;
+            StmtId yesBranch;
+            StmtId noBranch; // Refers to no statement without an else
+
+            IfStatement(ExprId condition, StmtId yesBranch, StmtId noBranch)
+                : condition(condition)
+                , yesBranch(yesBranch)
+                , noBranch(noBranch)
             { }
         };
 
-        struct FuncStatement : Statement {
-            std::vector<Token> params;
-            std::vector<std::unique_ptr<Statement>> statements;
-            Token tokenFunc, tokenName;
-
-            FuncStatement(
-                  const Token& tokenFunc
-                , const Token& tokenName
-                , decltype(params)&& params
-                , decltype(statements)&& statements
-            )   
-                : Statement(tokenFunc.line)
-                , params(std::move(params))
-                , statements(std::move(statements))
-                , tokenFunc(tokenFunc)
-                , tokenName(tokenName)
+        // Text of a function body between its braces, as offsets into the
+        // script source
+        struct SourceRange {
+            std::uint32_t offset{};
+            std::uint32_t length{};
+            int line{}; // Line the body starts on
+        };
+
+        struct FuncStatement {
+            Symbol name;
+            IndexRange<Symbol> params;
+            StatementList statements; // Empty until parsed when the body was deferred
+            SourceRange body;
+
+            // Set by the resolver. Slots start with one per parameter.
+            Binding binding;
+            IndexRange<Symbol> slots;
+
+            FuncStatement(Symbol name, IndexRange<Symbol> params, StatementList statements, SourceRange body = {})
+                : name(name)
+                , params(params)
+                , statements(statements)
+                , body(body)
             { }
+
+            // A parsed body always ends in a return, so it is never empty
+            bool IsParsed() const { return not statements.empty(); }
         };
 
-        struct ReturnStatement : Statement {
-            std::unique_ptr<Expr> expr;
+        struct ReturnStatement {
+            ExprId expr; // Refers to no expression for a bare return
 
-            ReturnStatement(int line, decltype(expr)&& expr)
-                : Statement(line)
-                , expr(std::move(expr))
+            ReturnStatement(ExprId expr)
+                : expr(expr)
             { }
         };
 
-        StatementEffect EvaluateStatement(const Statement& stmt, Interpreter& errors);
+        // Runs step, a statement, until it finishes or has to evaluate a child
+        StatementEffect EvaluateStatement(const Step& step, Interpreter& interpreter);
     }
 }
\ No newline at end of file
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace dxsh {
+    namespace core {
+        // Dense id of an interned identifier, numbered from 0 in order of first appearance
+        using Symbol = std::uint32_t;
+
+        // Interns identifier names so that variables can be keyed by integer.
+        // Names are views into the sources they were lexed from, which must
+        // outlive the table.
+        class SymbolTable {
+            std::unordered_map<std::string_view, Symbol> ids;
+            std::vector<std::string_view> names;
+
+            public:
+            // Returns the existing symbol for name, or a new one
+            Symbol Intern(std::string_view name);
+
+            std::string_view GetName(Symbol symbol) const { return names[symbol]; }
+            std::size_t Size() const { return names.size(); }
+        };
+    }
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Tokens.hpp"
+
+namespace dxsh {
+    namespace core {
+        // Packed struct-of-arrays token stream. Each token costs a 1-byte type,
+        // a 4-byte source offset and a 4-byte length. Line numbers are derived
+        // from a table of line starts, and only decoded number literals are
+        // kept in a side table. Tokens are materialized on access and hold views
+        // into the source, which must outlive the buffer. Reading through a
+        // Cursor costs nothing extra per token, reading by index searches.
+        class TokenBuffer {
+            std::string_view source;
+
+            std::vector<TokenType> types;
+            std::vector<std::uint32_t> offsets;
+            std::vector<std::uint32_t> lengths;
+
+            // Source offset of the start of every line, lineStarts[0] is line 1
+            std::vector<std::uint32_t> lineStarts{ 0 };
+
+            // Decoded literals keyed by token index, in ascending order
+            std::vector<std::pair<std::uint32_t, Token::Literal>> literals;
+
+            // Symbols of identifiers keyed by token index, in ascending order
+            std::vector<std::pair<std::uint32_t, Symbol>> symbols;
+
+            public:
+            TokenBuffer() = default;
+            explicit TokenBuffer(std::string_view source) : source(source) { }
+
+            void Push(TokenType type, std::uint32_t offset, std::uint32_t length);
+            void Push(TokenType type, std::uint32_t offset, std::uint32_t length, Token::Literal literal);
+            void PushIdentifier(std::uint32_t offset, std::uint32_t length, Symbol symbol);
+
+            // Marks offset as the first character of a new line
+            void AddLineStart(std::uint32_t offset) { lineStarts.push_back(offset); }
+
+            // Where the contents of another buffer go when appended to this one
+            struct Placement {
+                std::uint32_t baseOffset;
+                std::size_t firstToken;
+                std::size_t firstLine;
+                std::size_t firstLiteral;
+                std::size_t firstSymbol;
+            };
+
+            // Appends buffers lexed from consecutive parts of this buffer's source,
+            // the first starting at the start of this buffer's last line. Each part
+            // starts at its base offset, and the Eof tokens of the parts are dropped.
+            //
+            // This is split in two: Extend makes room for all the parts at once,
+            // returning where each goes, then CopyIn fills in a part. CopyIn may run
+            // concurrently for different parts. Parts lexed with their own symbol
+            // table have their symbols translated through symbolMap.
+            std::vector<Placement> Extend(std::span<const TokenBuffer> parts, std::span<const std::size_t> baseOffsets);
+            void CopyIn(const TokenBuffer& part, const Placement& placement, std::span<const Symbol> symbolMap);
+
+            std::size_t Size() const { return types.size(); }
+            int LineCount() const { return static_cast<int>(lineStarts.size()); }
+            std::string_view Source() const { return source; }
+
+            TokenType GetType(std::size_t index) const { return types[index]; }
+            int GetLine(std::size_t index) const;
+            std::string_view GetLexeme(std::size_t index) const;
+
+            Token Get(std::size_t index) const;
+
+            // A token position that keeps track of its line and its entries in
+            // the side tables, so tokens read in order need no searching
+            struct Cursor {
+                std::size_t index{};
+                std::size_t line{};    // In lineStarts
+                std::size_t literal{}; // First literal at or after index
+                std::size_t symbol{};  // First symbol at or after index
+            };
+
+            // Cursor at the first token, on whatever line it starts
+            Cursor Begin() const;
+
+            Token Get(const Cursor& cursor) const;
+            void Advance(Cursor& cursor) const;
+
+            private:
+            // Moves the line of cursor up to the line its token starts on
+            void SyncLine(Cursor& cursor) const;
+        };
+    }
+}
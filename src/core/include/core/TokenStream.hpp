@@ -0,0 +1,32 @@
+#pragma once
+
+#include <array>
+#include <string_view>
+
+#include "Lexer.hpp"
+#include "Tokens.hpp"
+
+namespace dxsh {
+    namespace core {
+        // Pulls tokens from a streaming Lexer on demand, keeping only the most
+        // recent few in a ring buffer. Token memory stays constant no matter
+        // how large the source is, as long as readers never look further back
+        // than Window - 1 tokens behind the newest one they requested.
+        class TokenStream {
+            static constexpr std::size_t Window = 4;
+
+            Lexer* lexer;
+            std::string_view source;
+            std::array<Token, Window> ring{};
+            std::size_t pulled{}; // Total tokens pulled from the lexer
+
+            public:
+            // Source must outlive the stream and every token taken from it. Tokens
+            // are numbered from firstLine.
+            TokenStream(Lexer& lexer, std::string_view source, int firstLine = 1);
+
+            const Token& Get(std::size_t index);
+            std::string_view Source() const { return source; }
+        };
+    }
+}
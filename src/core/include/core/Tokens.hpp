@@ -1,16 +1,20 @@
 #pragma once
 
+#include <cstdint>
 #include <variant>
 #include <string>
+#include <string_view>
 #include <format>
 #include <magic_enum/magic_enum.hpp>
 #include <iosfwd>
 #include <unordered_map>
 #include <optional>
 
+#include "Symbols.hpp"
+
 namespace dxsh {
     namespace core {
-        enum class TokenType {
+        enum class TokenType : std::uint8_t {
             // Brackets
               ParenL, ParenR, BraceL, BraceR, BracketL, BracketR
             // Separators
@@ -39,11 +43,19 @@ namespace dxsh {
         TokenType GetPotentialKeywordTokenType(std::string_view lexeme);
         TokenClass GetTokenClass(TokenType type);
 
+        // Spelling of operators, punctuation and keywords
+        std::string_view GetTokenRepresentation(TokenType type);
+
+        // Lexemes and string literals are views into the source the token was
+        // lexed from, which must outlive the token
         struct Token {
+            using Literal = std::variant<std::monostate, std::string_view, int, float>;
+
             TokenType type{};
             int line{};
-            std::string lexeme{};
-            std::variant<std::monostate, std::string, int, float> literal{};
+            std::string_view lexeme{};
+            Literal literal{};
+            Symbol symbol{}; // Identifiers only
 
             std::string_view GetRepresentation() const;
 
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Bytecode.hpp"
+#include "Error.hpp"
+#include "Program.hpp"
+#include "Symbols.hpp"
+#include "YieldBudget.hpp"
+
+namespace dxsh {
+    namespace core {
+        // Runs programs compiled to bytecode, as an alternative to the tree
+        // walking Interpreter with the same output and errors. Calls don't
+        // recurse natively, each one pushes a frame onto an explicit stack,
+        // which is kept between runs.
+        //
+        // Every block scope of a function shares one frame of slots, laid out
+        // at compile time. Leaving a block undeclares its slots, so that names
+        // looked up dynamically see exactly the variables an Environment would.
+        //
+        // A call in return position replaces the frame of the function making
+        // it, when that can't change what any name refers to.
+        class VM {
+            struct Slot {
+                Value value;
+                Symbol symbol{};
+                bool declared{};
+            };
+
+            struct Frame {
+                const Chunk* chunk;
+                std::uint32_t pc;      // Where to resume once the callee returns
+                std::size_t slotBase;  // First slot of the frame in slots
+                std::size_t stackBase; // Height of the operand stack below the callee
+            };
+
+            const Program& program;
+            const SymbolTable& symbols;
+            std::function<StatementList(std::uint32_t)> functionParser;
+
+            std::vector<Value> stack;
+            std::vector<Slot> slots;
+            std::vector<Slot> globals; // Indexed by symbol
+            std::vector<Frame> frames;
+
+            // Compiled on their first call, indexed like the FuncStatements
+            std::vector<std::unique_ptr<Chunk>> functions;
+
+            std::string output;
+
+            std::function<void(void)> interface;
+            YieldCounter yieldCounter;
+
+            // Bytes that frames, their slots and operands may take up together
+            std::size_t stackLimit = DefaultStackLimit;
+            bool tailCalls = true;
+
+            public:
+            static constexpr std::size_t DefaultStackLimit = 64 << 20;
+
+            ErrorContext errors;
+
+            // program must outlive the VM. symbols are the ones it was lexed with.
+            VM(const Program& program, const SymbolTable& symbols);
+
+            // Parses deferred function bodies, as for the Interpreter
+            void LoadFunctionParser(std::function<StatementList(std::uint32_t)> parser);
+
+            // Called whenever the yield budget runs out, to take the output so far
+            void LoadInterface(std::function<void(void)> interface);
+
+            // Counted as described for YieldCounter, with calls and returns as the
+            // steps. Steps through statements with output one at a time by default.
+            void SetYieldBudget(YieldBudget budget) { yieldCounter.SetBudget(budget); }
+
+            // Calls that would take the stack past bytes fail with a stack
+            // overflow error, so deep recursion is bounded by memory alone
+            void SetStackLimit(std::size_t bytes) { stackLimit = bytes; }
+
+            // Turning tail calls off keeps a frame for every call, for debugging
+            void SetTailCalls(bool enabled) { tailCalls = enabled; }
+
+            // Compiles and runs resolved statements in the global scope. Returns
+            // false once one fails, with the error in errors. Globals carry over
+            // between runs.
+            bool Run(StatementList statements);
+
+            std::string TakeOutput();
+
+            private:
+            bool Execute(const Chunk& script);
+
+            const Chunk& GetChunk(const Function& function);
+
+            // Fails if frameCount frames with slotCount slots in all wouldn't fit
+            void CheckStackSize(std::size_t frameCount, std::size_t slotCount, int line) const;
+
+            // Pushes a frame calling the function under the argc arguments on
+            // top of the stack, returning its chunk
+            const Chunk& PushFrame(std::uint32_t argc, int line);
+
+            // Sets up the slots of a frame at base, taking the arguments off the stack
+            void MoveArguments(const Function& function, const Chunk& callee, std::size_t base, std::uint32_t argc);
+
+            // Same as Interpreter::CanReplaceFunction, for the running frame
+            bool CanReplaceFrame(const Function& function) const;
+
+            // Calls only ever leave a few operands to drop, which this does
+            // faster than resize
+            void PopTo(std::size_t height) {
+                while (stack.size() > height) stack.pop_back();
+            }
+
+            Slot* GetVar(const VarRef& var);
+            Slot* FindGlobal(Symbol symbol);
+
+            // Looks symbol up by name through the declared slots below below, in
+            // frame and then in every caller, and then in the globals
+            Slot* FindVar(Symbol symbol, std::size_t frame, std::size_t below);
+        };
+    }
+}
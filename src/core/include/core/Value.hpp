@@ -1,10 +1,11 @@
 #pragma once
 
-#include <memory>
-#include <span>
+#include <concepts>
+#include <cstdint>
 #include <string>
-#include <variant>
-#include <vector>
+#include <utility>
+#include "NodeId.hpp"
+#include "Symbols.hpp"
 
 
 namespace dxsh {
@@ -21,38 +22,175 @@ namespace dxsh {
             , Function
         };
 
+        // Where the variable named by an identifier lives at runtime, as worked
+        // out by the scope resolver
+        struct Binding {
+            enum class Kind : std::uint8_t {
+                  Dynamic // Looked up by symbol through every enclosing environment
+                , Global  // In the global table, indexed by symbol
+                , Local   // In a slot of an enclosing scope of the same function
+            };
+
+            Kind kind = Kind::Dynamic;
+            std::uint16_t hops{}; // Scopes out from the current one, for Local
+            std::uint32_t slot{}; // For Local
+
+            auto operator<=>(const Binding&) const = default;
+        };
+
         struct Lvalue {
             int lineOfRef;
-            std::string_view name; // Name comes from statements, non-owning is fine
+            Symbol symbol;
+            std::string_view name; // Only for messages. Comes from statements, non-owning is fine
+            Binding binding{};
 
             auto operator<=>(const Lvalue&) const = default;
         };
 
-        struct Statement;
         struct Function {
             int line;
-            std::string_view name; // Statements live as long as the program, non-owning is fine
-            std::vector<std::string_view> params; // Same with string_view
-            std::span<const std::unique_ptr<Statement>> statements; // Same with the span
+            std::string_view name; // Interned name, a view into the source, which outlives the program
+            IndexRange<Symbol> params; // In the Program's symbol lists, so copying a Function is cheap
+            std::uint32_t definition; // Index of the FuncStatement in the Program, which holds the body
 
             std::size_t Arity() const { return params.size(); }
         };
 
+        namespace detail {
+            // Heap storage shared by copies of a Value, for types that don't
+            // fit in one. Counted without atomics, as values never cross threads.
+            struct Box {
+                std::uint32_t refs = 1;
+            };
+
+            template<typename T>
+            struct BoxOf : Box {
+                T value;
+
+                explicit BoxOf(T value) : value(std::move(value)) { }
+            };
+
+            template<typename T>
+            inline constexpr ValueType TypeOf = []() {
+                if constexpr (std::same_as<T, int>)              return ValueType::Integer;
+                else if constexpr (std::same_as<T, float>)       return ValueType::Decimal;
+                else if constexpr (std::same_as<T, std::string>) return ValueType::String;
+                else if constexpr (std::same_as<T, bool>)        return ValueType::Boolean;
+                else if constexpr (std::same_as<T, Lvalue>)      return ValueType::Lvalue;
+                else if constexpr (std::same_as<T, Function>)    return ValueType::Function;
+            }();
+
+            template<typename T>
+            concept Boxed = std::same_as<T, std::string> || std::same_as<T, Lvalue> || std::same_as<T, Function>;
+        }
+
+        // A type tag and a word of payload, 16 bytes in all. Numbers and
+        // booleans are held inline. Strings, lvalues and functions live in a
+        // reference counted box, so copying any value never allocates. Boxes
+        // are shared, so values can only be replaced, never changed in place.
         class Value {
-            std::variant<std::monostate, int, float, std::string, bool, Lvalue, Function> value;
+            union Payload {
+                int integer;
+                float decimal;
+                bool boolean;
+                detail::Box* box;
+            };
+
+            Payload payload{ .box = nullptr };
+            ValueType type = ValueType::Null;
+
+            template<typename T>
+            Value(ValueType type, T value) : type(type) {
+                if constexpr (detail::Boxed<T>)
+                    payload.box = new detail::BoxOf<T>(std::move(value));
+                else if constexpr (std::same_as<T, int>)
+                    payload.integer = value;
+                else if constexpr (std::same_as<T, float>)
+                    payload.decimal = value;
+                else
+                    payload.boolean = value;
+            }
+
+            static constexpr unsigned BoxedTypes = 1u << static_cast<unsigned>(ValueType::String)
+                | 1u << static_cast<unsigned>(ValueType::Lvalue)
+                | 1u << static_cast<unsigned>(ValueType::Function);
+
+            bool IsBoxed() const {
+                return BoxedTypes & 1u << static_cast<unsigned>(type);
+            }
+
+            void Retain() const {
+                if (IsBoxed()) payload.box->refs++;
+            }
+
+            void Release() {
+                if (IsBoxed() && --payload.box->refs == 0)
+                    FreeBox();
+            }
+
+            void FreeBox();
+            [[noreturn]] void ThrowWrongType() const;
+
+            template<typename T>
+            void Check() const {
+                if (type != detail::TypeOf<T>) [[unlikely]]
+                    ThrowWrongType();
+            }
 
             public:
             Value() = default;
-            Value(auto value) : value(std::move(value)) { }
+            Value(int value)         : Value(ValueType::Integer, value) { }
+            Value(float value)       : Value(ValueType::Decimal, value) { }
+            Value(bool value)        : Value(ValueType::Boolean, value) { }
+            Value(std::string value) : Value(ValueType::String, std::move(value)) { }
+            Value(const char* value) : Value(std::string(value)) { }
+            Value(Lvalue value)      : Value(ValueType::Lvalue, std::move(value)) { }
+            Value(Function value)    : Value(ValueType::Function, std::move(value)) { }
+
+            Value(const Value& other) : payload(other.payload), type(other.type) {
+                Retain();
+            }
 
-            template<typename T>
-            const T& GetAs() const { return std::get<T>(value); }
+            Value(Value&& other) noexcept : payload(other.payload), type(other.type) {
+                other.type = ValueType::Null;
+            }
+
+            Value& operator=(const Value& other) {
+                other.Retain();
+                Release();
+                payload = other.payload;
+                type = other.type;
+                return *this;
+            }
+
+            Value& operator=(Value&& other) noexcept {
+                if (this != &other) {
+                    Release();
+                    payload = other.payload;
+                    type = std::exchange(other.type, ValueType::Null);
+                }
+
+                return *this;
+            }
+
+            ~Value() { Release(); }
 
             template<typename T>
-            T& GetAs() { return std::get<T>(value); }
+            const T& GetAs() const {
+                Check<T>();
+
+                if constexpr (detail::Boxed<T>)
+                    return static_cast<const detail::BoxOf<T>*>(payload.box)->value;
+                else if constexpr (std::same_as<T, int>)
+                    return payload.integer;
+                else if constexpr (std::same_as<T, float>)
+                    return payload.decimal;
+                else
+                    return payload.boolean;
+            }
 
             ValueType GetType() const {
-                return static_cast<ValueType>(value.index());
+                return type;
             }
 
             bool IsArithmetic() const { 
@@ -67,5 +205,7 @@ namespace dxsh {
             std::string ToString() const;
             std::string ToPrettyString() const;
         };
+
+        static_assert(sizeof(Value) == 16);
     }
 }
\ No newline at end of file
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace dxsh {
+    namespace core {
+        // How much may run before control goes back to the interface, which
+        // prints output. Whichever limit is reached first ends the slice, and a
+        // limit of zero is none. Only statements with output count against the
+        // statement limit, since output is all a yield is for, so a budget of
+        // one statement steps through a program's output. No limits at all runs
+        // it to completion.
+        struct YieldBudget {
+            std::size_t statements = 1;
+            std::chrono::microseconds time{};
+        };
+
+        // Counts statements against a budget. Both engines count every statement
+        // with output, and every other step of work, so that a long stretch
+        // without output still ends the slice once the time is up. Steps are
+        // statements on the tree walker, and calls and returns on the VM.
+        class YieldCounter {
+            using Clock = std::chrono::steady_clock;
+
+            // Reading the clock costs more than a simple step, so the time limit
+            // is only checked this often between statements with output
+            static constexpr std::size_t TimeCheckInterval = 64;
+
+            YieldBudget budget;
+            std::size_t count{}; // Statements with output
+            std::size_t steps{};
+            Clock::time_point start;
+
+            bool TimeIsUp() const {
+                return budget.time.count() != 0 && Clock::now() - start >= budget.time;
+            }
+
+            public:
+            void SetBudget(YieldBudget budget) {
+                this->budget = budget;
+                Reset();
+            }
+
+            // Starts a new slice
+            void Reset() {
+                count = 0;
+                steps = 0;
+
+                if (budget.time.count() != 0)
+                    start = Clock::now();
+            }
+
+            // Counts a statement with output, returning true once the slice is
+            // used up. The clock is read every time, so output never waits past
+            // the time limit.
+            bool TickOutput() {
+                count++;
+
+                if (budget.statements != 0 && count >= budget.statements)
+                    return true;
+
+                return TimeIsUp();
+            }
+
+            // Counts a step without output, returning true once the time is up
+            bool Tick() {
+                steps++;
+                return steps % TimeCheckInterval == 0 && TimeIsUp();
+            }
+        };
+    }
+}
@@ -1,8 +1,15 @@
-#include <fstream>
 #include "core/Lexer.hpp"
 #include "core/Interpreter.hpp"
+#include "core/ParallelLexer.hpp"
+#include "core/Optimizer.hpp"
 #include "core/Parser.hpp"
+#include "core/Resolver.hpp"
+#include "core/ProgramImage.hpp"
+#include "core/SourceBuffer.hpp"
+#include "core/TokenStream.hpp"
+#include "core/VM.hpp"
 #include "InterpreterInterface.hpp"
+#include "ProgramCache.hpp"
 
 using namespace dxsh;
 using namespace shell;
@@ -11,10 +18,11 @@ using namespace core;
 void shell::InterpreterInterface(
       Interpreter& interpreter
     , Terminal& term
-    , std::span<const std::unique_ptr<Statement>> statements
+    , const Program& program
+    , StatementList statements
     , bool quitOnError) {
 
-    interpreter.LoadProgram(statements);
+    interpreter.LoadProgram(program, statements);
 
     interpreter.LoadInterface([&interpreter, &term, quitOnError]() {
         for (auto res : interpreter.ExecuteTopContext()) {
@@ -26,6 +34,8 @@ void shell::InterpreterInterface(
                 case RuntimeStatus::ClosedContext:
                     return;
                 case RuntimeStatus::Error:
+                    // Statements since the last yield may have printed
+                    term.Print(interpreter.TakeOutput());
                     term.PrintErrors(interpreter.errors);
                     interpreter.ResetIO();
 
@@ -37,13 +47,62 @@ void shell::InterpreterInterface(
         }
     });
 
-    interpreter.RunInterface();
+    try {
+        interpreter.RunInterface();
+    } catch (...) {
+        term.Print(interpreter.TakeOutput());
+        throw;
+    }
+
+    term.Print(interpreter.TakeOutput());
 }
 
-void shell::REPL(Terminal& term) {
+void shell::VMInterface(VM& vm, Terminal& term, StatementList statements, bool quitOnError) {
+    bool succeeded;
+
+    vm.LoadInterface([&vm, &term]() {
+        term.Print(vm.TakeOutput());
+    });
+
+    // Whatever is left is printed once the run stops, whichever way it does
+    try {
+        succeeded = vm.Run(statements);
+    } catch (...) {
+        term.Print(vm.TakeOutput());
+        throw;
+    }
+
+    term.Print(vm.TakeOutput());
+
+    if (not succeeded) {
+        term.PrintErrors(vm.errors);
+        vm.errors.clear();
+
+        if (quitOnError)
+            throw std::runtime_error("Interpreter quitting...");
+    }
+}
+
+void shell::REPL(Terminal& term, const Options& options) {
     Interpreter interpreter;
     auto& errors = interpreter.errors;
 
+    // Tokens, variables and functions refer back into the source and statements
+    // of the line that created them, so both live for the whole session. Every
+    // line is parsed into the same program.
+    SourceArena sources;
+    Program program;
+
+    VM vm(program, interpreter.symbols);
+    vm.SetStackLimit(options.stackSize);
+    vm.SetTailCalls(options.tailCalls);
+
+    // Each statement's output shows as soon as it runs
+    interpreter.SetYieldBudget({ .statements = 1 });
+    interpreter.SetStackLimit(options.stackSize);
+    interpreter.SetTailCalls(options.tailCalls);
+    vm.SetYieldBudget({ .statements = 1 });
+
     term.PrintWelcome();
 
     while (true) {
@@ -53,56 +112,210 @@ void shell::REPL(Terminal& term) {
 
         std::string input = term.AcceptInput();
 
-        if (not input.ends_with(';'))
+        // Blocks and function definitions don't take a trailing semicolon
+        if (not input.ends_with(';') && not input.ends_with('}'))
             input.push_back(';');
 
-        core::Lexer lexer(errors);
-        const auto tokens = lexer.Parse(input);
+        core::Lexer lexer(errors, interpreter.symbols);
+        const auto tokens = lexer.Parse(sources.Retain(input));
 
         if (not errors.empty()) {
             term.PrintErrors(errors);
             continue;
         }
 
-        core::Parser parser(errors);
-        const auto statements = parser.Parse(tokens);
+        core::Parser parser(errors, program);
+        auto statements = parser.Parse(tokens);
 
         if (not errors.empty()) {
             term.PrintErrors(errors);
             continue;
         }
 
-        shell::InterpreterInterface(interpreter, term, statements, false);
+        ResolveScopes(program, statements);
+
+        if (options.optimize)
+            FoldConstants(program, statements);
+
+        if (options.engine == Engine::VM)
+            shell::VMInterface(vm, term, statements, false);
+        else
+            shell::InterpreterInterface(interpreter, term, program, statements, false);
+    }
+}
+
+// Runs each top-level statement of contents as soon as it is parsed. Once a
+// statement has run, its nodes are dropped, unless it defined a function that
+// may still be called. A linear script then only ever holds one statement.
+static void StreamFile(Terminal& term, std::string_view contents, const Options& options) {
+    Interpreter interpreter;
+    auto& errors = interpreter.errors;
+
+    ErrorContext lexErrors;
+    Program program;
+    Parser parser(errors, program);
+    Lexer lexer(lexErrors, interpreter.symbols);
+    TokenStream tokens(lexer, contents);
+
+    VM vm(program, interpreter.symbols);
+    vm.SetStackLimit(options.stackSize);
+    vm.SetTailCalls(options.tailCalls);
+
+    interpreter.SetYieldBudget(options.yieldBudget);
+    interpreter.SetStackLimit(options.stackSize);
+    interpreter.SetTailCalls(options.tailCalls);
+    vm.SetYieldBudget(options.yieldBudget);
+
+    parser.Start(tokens);
+
+    while (not parser.IsAtEnd()) {
+        const auto checkpoint = program.GetCheckpoint();
+        const std::size_t functions = program.funcStmts.size();
+        const StmtId stmt = parser.ParseTopLevel();
+
+        if (not lexErrors.empty()) {
+            term.PrintErrors(lexErrors);
+            return;
+        }
+
+        if (not errors.empty()) {
+            term.PrintErrors(errors);
+            return;
+        }
+
+        const StatementList statements = program.AddList(std::span(&stmt, 1));
+        ResolveScopes(program, statements);
+
+        if (options.optimize)
+            FoldConstants(program, statements);
+
+        if (options.engine == Engine::VM)
+            shell::VMInterface(vm, term, statements, true);
+        else
+            shell::InterpreterInterface(interpreter, term, program, statements, true);
+
+        // Function values refer to the statements of their definitions
+        if (program.funcStmts.size() == functions)
+            program.Rollback(checkpoint);
     }
 }
 
-static std::string FileToString(std::ifstream& file) {
-    std::ostringstream ss;
-    ss << file.rdbuf();
-    return ss.str();
+// Parses the bodies that the parser deferred, on the first call of their function
+static auto MakeFunctionParser(
+      ErrorContext& errors
+    , SymbolTable& symbols
+    , Program& program
+    , std::string_view contents
+    , const Options& options
+) {
+    return [&errors, &symbols, &program, contents, &options](std::uint32_t func) {
+        Parser parser(errors, program);
+        parser.DeferFunctionBodies(true);
+
+        const StatementList body = parser.ParseFunctionBody(func, contents, symbols);
+        ResolveFunctionBody(program, func);
+
+        if (options.optimize)
+            FoldConstants(program, body);
+
+        return body;
+    };
 }
 
-void shell::File(Terminal& term, std::ifstream& file) {
-    const std::string contents = FileToString(file);
+// Runs a whole script with the engine picked in options, quitting on the first error
+static void Run(
+      Terminal& term
+    , Interpreter& interpreter
+    , Program& program
+    , StatementList statements
+    , std::string_view contents
+    , const Options& options
+) {
+    if (options.engine == Engine::Tree) {
+        interpreter.SetYieldBudget(options.yieldBudget);
+        interpreter.SetStackLimit(options.stackSize);
+        interpreter.SetTailCalls(options.tailCalls);
+        interpreter.LoadFunctionParser(MakeFunctionParser(interpreter.errors, interpreter.symbols, program, contents, options));
+        shell::InterpreterInterface(interpreter, term, program, statements, true);
+        return;
+    }
+
+    VM vm(program, interpreter.symbols);
+    vm.SetStackLimit(options.stackSize);
+    vm.SetTailCalls(options.tailCalls);
+    vm.SetYieldBudget(options.yieldBudget);
+    vm.LoadFunctionParser(MakeFunctionParser(vm.errors, interpreter.symbols, program, contents, options));
+
+    shell::VMInterface(vm, term, statements, true);
+}
+
+void shell::File(Terminal& term, const SourceFile& source, const Options& options) {
+    const std::string_view contents = source.Contents();
+
+    if (options.stream && not options.check) {
+        StreamFile(term, contents, options);
+        return;
+    }
 
     Interpreter interpreter;
     auto& errors = interpreter.errors;
 
-    Lexer lexer(errors);
-    const auto tokens = lexer.Parse(contents);
+    const auto cache = options.useCache && not options.check ? ProgramCache::Open() : std::nullopt;
+    const std::uint64_t key = cache ? ProgramImageKey(contents, options.optimize) : 0;
 
-    if (not errors.empty()) {
-        term.PrintErrors(errors);
+    // Symbol names of a cached program are views into its image, so the image
+    // stays mapped for the whole run
+    std::optional<SourceFile> image;
+
+    if (cache && (image = cache->Find(key))) {
+        if (auto loaded = LoadProgramImage(image->Contents(), key, contents)) {
+            interpreter.symbols = std::move(loaded->symbols);
+            Run(term, interpreter, loaded->program, loaded->statements, contents, options);
+            return;
+        }
+    }
+
+    // Lexing errors are kept apart, since they take priority over the parse errors they cause
+    ErrorContext lexErrors;
+    Program program;
+    Parser parser(errors, program);
+    StatementList statements;
+
+    // Most function bodies in large scripts are never called, so they are only
+    // parsed once they are. Checking needs them all.
+    parser.DeferFunctionBodies(not options.check);
+
+    if (options.lexThreads > 1) {
+        // Lexing up front lets the whole script be split between threads
+        const auto tokens = LexParallel(contents, lexErrors, interpreter.symbols, options.lexThreads);
+        statements = parser.Parse(tokens);
+    } else {
+        // Otherwise tokens are lexed on demand as the parser asks for them
+        Lexer lexer(lexErrors, interpreter.symbols);
+        TokenStream tokens(lexer, contents);
+        statements = parser.Parse(tokens);
+    }
+
+    if (not lexErrors.empty()) {
+        term.PrintErrors(lexErrors);
         return;
     }
-    
-    Parser parser(errors);
-    const auto statements = parser.Parse(tokens);
 
     if (not errors.empty()) {
         term.PrintErrors(errors);
         return;
     }
-    
-    shell::InterpreterInterface(interpreter, term, statements, true);
+
+    if (options.check)
+        return;
+
+    ResolveScopes(program, statements);
+
+    if (options.optimize)
+        FoldConstants(program, statements);
+
+    if (cache)
+        cache->Store(key, SaveProgramImage(program, statements, interpreter.symbols, key, contents));
+
+    Run(term, interpreter, program, statements, contents, options);
 }
\ No newline at end of file
@@ -1,8 +1,12 @@
 #pragma once 
 
 #include <span>
+#include "core/Program.hpp"
 #include "core/Statement.hpp"
 #include "core/Interpreter.hpp"
+#include "core/VM.hpp"
+#include "Options.hpp"
+#include "SourceFile.hpp"
 #include "Terminal.hpp"
 
 
@@ -11,11 +15,15 @@ namespace dxsh {
         void InterpreterInterface(
               core::Interpreter& interpreter
             , Terminal& term
-            , std::span<const std::unique_ptr<core::Statement>> statements
+            , const core::Program& program
+            , core::StatementList statements
             , bool quitOnError
         );
 
-        void REPL(Terminal& term);
-        void File(Terminal& term, std::ifstream& file);
+        // Same as InterpreterInterface, for statements of the program vm runs
+        void VMInterface(core::VM& vm, Terminal& term, core::StatementList statements, bool quitOnError);
+
+        void REPL(Terminal& term, const Options& options);
+        void File(Terminal& term, const SourceFile& source, const Options& options);
     }
 }
\ No newline at end of file
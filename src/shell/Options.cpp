@@ -0,0 +1,97 @@
+#include <algorithm>
+#include <charconv>
+#include <format>
+#include <string_view>
+#include <thread>
+#include "Options.hpp"
+
+using namespace dxsh;
+using namespace shell;
+
+static std::optional<unsigned> ParseUnsigned(std::string_view str) {
+    unsigned value;
+    auto [end, ec] = std::from_chars(str.data(), str.data() + str.size(), value);
+
+    if (ec != std::errc{} || end != str.data() + str.size())
+        return std::nullopt;
+
+    return value;
+}
+
+std::optional<Options> shell::ParseOptions(Terminal& term, std::span<char*> args) {
+    Options options;
+
+    for (std::string_view arg : args) {
+        if (arg.starts_with("--lex-threads=")) {
+            auto threads = ParseUnsigned(arg.substr(arg.find('=') + 1));
+
+            if (not threads) {
+                term.PrintError(std::format("Invalid thread count in '{}'", arg));
+                return std::nullopt;
+            }
+
+            // 0 picks one thread per core
+            options.lexThreads = *threads != 0 ? *threads : std::max(std::thread::hardware_concurrency(), 1u);
+        } else if (arg == "--no-cache") {
+            options.useCache = false;
+        } else if (arg == "--no-opt") {
+            options.optimize = false;
+        } else if (arg == "--stream") {
+            options.stream = true;
+        } else if (arg == "--check") {
+            options.check = true;
+        } else if (arg == "--step") {
+            options.yieldBudget = { .statements = 1 };
+        } else if (arg.starts_with("--yield-statements=")) {
+            auto statements = ParseUnsigned(arg.substr(arg.find('=') + 1));
+
+            if (not statements) {
+                term.PrintError(std::format("Invalid statement count in '{}'", arg));
+                return std::nullopt;
+            }
+
+            options.yieldBudget.statements = *statements;
+        } else if (arg.starts_with("--yield-time=")) {
+            auto micros = ParseUnsigned(arg.substr(arg.find('=') + 1));
+
+            if (not micros) {
+                term.PrintError(std::format("Invalid time in '{}'", arg));
+                return std::nullopt;
+            }
+
+            options.yieldBudget.time = std::chrono::microseconds(*micros);
+        } else if (arg.starts_with("--stack-size=")) {
+            auto megabytes = ParseUnsigned(arg.substr(arg.find('=') + 1));
+
+            if (not megabytes || *megabytes == 0 || *megabytes > 65536) {
+                term.PrintError(std::format("Invalid stack size in '{}'", arg));
+                return std::nullopt;
+            }
+
+            options.stackSize = std::size_t(*megabytes) << 20;
+        } else if (arg == "--no-tail-calls") {
+            options.tailCalls = false;
+        } else if (arg.starts_with("--engine=")) {
+            const std::string_view engine = arg.substr(arg.find('=') + 1);
+
+            if (engine == "tree") {
+                options.engine = Engine::Tree;
+            } else if (engine == "vm") {
+                options.engine = Engine::VM;
+            } else {
+                term.PrintError(std::format("Unknown engine in '{}'", arg));
+                return std::nullopt;
+            }
+        } else if (arg.starts_with("--")) {
+            term.PrintError(std::format("Unknown option '{}'", arg));
+            return std::nullopt;
+        } else if (options.script == nullptr) {
+            options.script = arg.data();
+        } else {
+            term.PrintError(std::format("Unexpected argument '{}'", arg));
+            return std::nullopt;
+        }
+    }
+
+    return options;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include "core/VM.hpp"
+#include "Terminal.hpp"
+
+namespace dxsh {
+    namespace shell {
+        enum class Engine {
+              Tree // Walks the statements of the program
+            , VM   // Compiles the program to bytecode first
+        };
+
+        struct Options {
+            // Script to run, or nullptr to start the REPL. "-" reads from stdin.
+            const char* script = nullptr;
+
+            // Threads used to lex the script. Only large scripts use more than one.
+            unsigned lexThreads = 1;
+
+            // Load and store compiled scripts in the program cache
+            bool useCache = true;
+
+            // Fold constant expressions before running
+            bool optimize = true;
+
+            // Run each top-level statement as soon as it is parsed, instead of
+            // parsing the whole script first. Statements before a syntax error
+            // still run. Bypasses the program cache.
+            bool stream = false;
+
+            // Only parse the script, fully, reporting every syntax error without
+            // running anything. Normal runs leave function bodies unparsed
+            // until they are first called.
+            bool check = false;
+
+            // Runs scripts on it, whether whole, streamed or in the REPL
+            Engine engine = Engine::Tree;
+
+            // How much of a script runs between printing its output. By default
+            // scripts run to completion, printing at most every 50ms. The REPL
+            // always steps through statements one at a time.
+            core::YieldBudget yieldBudget{ .statements = 0, .time = std::chrono::milliseconds(50) };
+
+            // Memory for nested calls and blocks, in bytes, on either engine
+            std::size_t stackSize = core::VM::DefaultStackLimit;
+
+            // Run calls in return position in place of their caller, where that
+            // can't change the result. Off, every call keeps its frame.
+            bool tailCalls = true;
+        };
+
+        // Parses the command line (without the program name), printing usage
+        // errors to the terminal
+        std::optional<Options> ParseOptions(Terminal& term, std::span<char*> args);
+    }
+}
@@ -0,0 +1,77 @@
+#include <cstdlib>
+#include <format>
+#include <fstream>
+#include <random>
+#include <system_error>
+
+#include "ProgramCache.hpp"
+
+using namespace dxsh;
+using namespace shell;
+
+static const char* GetNonEmptyEnv(const char* name) {
+    const char* value = std::getenv(name);
+    return value != nullptr && *value != '\0' ? value : nullptr;
+}
+
+std::optional<ProgramCache> ProgramCache::Open() {
+    if (const char* dir = GetNonEmptyEnv("DXSH_CACHE_DIR"))
+        return ProgramCache(dir);
+
+#ifdef _WIN32
+    if (const char* dir = GetNonEmptyEnv("LOCALAPPDATA"))
+        return ProgramCache(std::filesystem::path(dir) / "dxsh" / "cache");
+#else
+    if (const char* dir = GetNonEmptyEnv("XDG_CACHE_HOME"))
+        return ProgramCache(std::filesystem::path(dir) / "dxsh");
+
+    if (const char* home = GetNonEmptyEnv("HOME"))
+        return ProgramCache(std::filesystem::path(home) / ".cache" / "dxsh");
+#endif
+
+    return std::nullopt;
+}
+
+std::filesystem::path ProgramCache::PathOf(std::uint64_t key) const {
+    return directory / std::format("{:016x}.dxc", key);
+}
+
+std::optional<SourceFile> ProgramCache::Find(std::uint64_t key) const {
+    const auto path = PathOf(key);
+    std::error_code error;
+
+    if (not std::filesystem::is_regular_file(path, error))
+        return std::nullopt;
+
+    return SourceFile::Open(path.string().c_str());
+}
+
+void ProgramCache::Store(std::uint64_t key, std::string_view image) const {
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+
+    if (error)
+        return;
+
+    // Write under a unique name, then rename over the real one, so that readers
+    // only ever see complete images
+    const auto path = PathOf(key);
+    auto temp = path;
+    temp += std::format(".{:08x}.tmp", std::random_device{}());
+
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        out.write(image.data(), static_cast<std::streamsize>(image.size()));
+
+        if (not out.flush()) {
+            out.close();
+            std::filesystem::remove(temp, error);
+            return;
+        }
+    }
+
+    std::filesystem::rename(temp, path, error);
+
+    if (error)
+        std::filesystem::remove(temp, error);
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+#include "SourceFile.hpp"
+
+namespace dxsh {
+    namespace shell {
+        // Directory of compiled program images (.dxc files), named by their key.
+        // The cache is best effort: anything missing, unreadable or unwritable
+        // is treated as a miss, and the script is parsed from source instead.
+        class ProgramCache {
+            std::filesystem::path directory;
+
+            explicit ProgramCache(std::filesystem::path directory) : directory(std::move(directory)) { }
+
+            public:
+            // Uses $DXSH_CACHE_DIR, or else the user's cache directory. Returns
+            // nullopt if neither is known.
+            static std::optional<ProgramCache> Open();
+
+            // Maps the image stored under key, if there is one. It still needs to
+            // be validated when loaded.
+            std::optional<SourceFile> Find(std::uint64_t key) const;
+
+            // Replaces the image stored under key. Concurrent runs of the same
+            // script may store at the same time, so the file is swapped in whole.
+            void Store(std::uint64_t key, std::string_view image) const;
+
+            private:
+            std::filesystem::path PathOf(std::uint64_t key) const;
+        };
+    }
+}
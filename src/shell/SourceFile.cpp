@@ -0,0 +1,145 @@
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include "SourceFile.hpp"
+
+#ifdef _WIN32
+    #include <fstream>
+    #include <iostream>
+    #include <iterator>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+using namespace dxsh;
+using namespace shell;
+
+#ifdef _WIN32
+
+std::optional<SourceFile> SourceFile::Open(const char* path) {
+    SourceFile file;
+
+    if (std::strcmp(path, "-") == 0) {
+        file.buffer.assign(std::istreambuf_iterator<char>(std::cin), {});
+    } else {
+        std::ifstream stream(path, std::ios::binary);
+
+        if (not stream.is_open())
+            return std::nullopt;
+
+        file.buffer.assign(std::istreambuf_iterator<char>(stream), {});
+    }
+
+    file.data = file.buffer.data();
+    file.size = file.buffer.size();
+
+    return file;
+}
+
+void SourceFile::Release() { }
+
+#else
+
+std::optional<SourceFile> SourceFile::Open(const char* path) {
+    bool isStdin = std::strcmp(path, "-") == 0;
+    int fd = isStdin ? STDIN_FILENO : ::open(path, O_RDONLY | O_CLOEXEC);
+
+    if (fd < 0)
+        return std::nullopt;
+
+    SourceFile file;
+    struct stat info{};
+
+    bool isRegular = ::fstat(fd, &info) == 0 && S_ISREG(info.st_mode);
+
+    if (isRegular && info.st_size > 0) {
+        auto length = static_cast<std::size_t>(info.st_size);
+        void* mapping = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (mapping != MAP_FAILED) {
+            // Read ahead aggressively and let pages behind the lexer go early
+            ::madvise(mapping, length, MADV_SEQUENTIAL);
+
+            file.data = static_cast<const char*>(mapping);
+            file.size = length;
+            file.mapped = true;
+        }
+    }
+
+    bool ok = file.mapped || file.ReadAll(fd);
+
+    if (not isStdin)
+        ::close(fd);
+
+    if (not ok)
+        return std::nullopt;
+
+    return file;
+}
+
+bool SourceFile::ReadAll(int fd) {
+    std::size_t length = 0;
+    buffer.resize(64 * 1024);
+
+    while (true) {
+        if (length == buffer.size())
+            buffer.resize(buffer.size() * 2);
+
+        ssize_t count = ::read(fd, buffer.data() + length, buffer.size() - length);
+
+        if (count == 0)
+            break;
+
+        if (count < 0) {
+            if (errno == EINTR)
+                continue;
+
+            return false;
+        }
+
+        length += static_cast<std::size_t>(count);
+    }
+
+    buffer.resize(length);
+
+    data = buffer.data();
+    size = buffer.size();
+
+    return true;
+}
+
+void SourceFile::Release() {
+    if (mapped)
+        ::munmap(const_cast<char*>(data), size);
+}
+
+#endif
+
+SourceFile::SourceFile(SourceFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+SourceFile& SourceFile::operator=(SourceFile&& other) noexcept {
+    if (this == &other)
+        return *this;
+
+    Release();
+
+    mapped = std::exchange(other.mapped, false);
+    size = std::exchange(other.size, 0);
+    buffer = std::move(other.buffer);
+
+    // A moved std::string may have relocated its (small) contents
+    data = mapped ? std::exchange(other.data, nullptr) : buffer.data();
+    other.data = nullptr;
+
+    return *this;
+}
+
+SourceFile::~SourceFile() {
+    Release();
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace dxsh {
+    namespace shell {
+        // Read-only contents of a script. Regular files are memory-mapped for
+        // sequential access, so loading them copies nothing and the kernel can
+        // reclaim pages the lexer has moved past. Anything that can't be mapped
+        // (pipes, stdin) is read into memory in a single pass.
+        class SourceFile {
+            const char* data = nullptr;
+            std::size_t size{};
+            bool mapped{};
+
+            std::string buffer; // Backing storage when not mapped
+
+            SourceFile() = default;
+
+            public:
+            // "-" opens stdin. Returns nullopt if the file can't be opened.
+            static std::optional<SourceFile> Open(const char* path);
+
+            SourceFile(SourceFile&& other) noexcept;
+            SourceFile& operator=(SourceFile&& other) noexcept;
+            ~SourceFile();
+
+            std::string_view Contents() const { return { data, size }; }
+
+            private:
+        #ifndef _WIN32
+            bool ReadAll(int fd);
+        #endif
+            void Release();
+        };
+    }
+}
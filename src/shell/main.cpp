@@ -1,7 +1,8 @@
-#include <fstream>
 #include <iostream>
 #include "Terminal.hpp"
 #include "InterpreterInterface.hpp"
+#include "Options.hpp"
+#include "SourceFile.hpp"
 #include "core/Error.hpp"
 #include "core/Interpreter.hpp"
 #include "core/Lexer.hpp"
@@ -16,22 +17,25 @@ using namespace core;
 using namespace std::string_literals;
 
 int main(int argc, char** argv) {
-    yorel::yomm2::update_methods();
-    
     Terminal term{};
 
+    auto options = shell::ParseOptions(term, std::span(argv + 1, argc - 1));
+
+    if (not options)
+        return 1;
+
     try {
-        if (argc == 1) {
-            shell::REPL(term);
+        if (options->script == nullptr) {
+            shell::REPL(term, *options);
         } else {
-            std::ifstream file(argv[1]);
+            auto source = shell::SourceFile::Open(options->script);
 
-            if (not file.is_open()) {
-                term.PrintError(std::format("Unable to open file '{}'", argv[1]));
+            if (not source) {
+                term.PrintError(std::format("Unable to open file '{}'", options->script));
                 return 1;
             }
 
-            shell::File(term, file);
+            shell::File(term, *source, *options);
         }
     } catch (const std::exception& e) {
         term.PrintError("Internal exception: "s + e.what());